@@ -15,6 +15,9 @@
  */
 #pragma once
 
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
@@ -37,6 +40,16 @@ namespace VGG
 class NativeExec final : public VggJSEngine
 {
 public:
+  struct TaskQueueStats
+  {
+    std::size_t               depth{ 0 }; // tasks waiting for the node thread
+    std::size_t               maxDepth{ 0 };
+    std::uint64_t             taskCount{ 0 };  // tasks run
+    std::uint64_t             batchCount{ 0 }; // wakeups of the node thread that ran tasks
+    std::chrono::microseconds totalLatency{ 0 }; // from scheduled to started, of all tasks
+    std::chrono::microseconds maxLatency{ 0 };
+  };
+
   static std::shared_ptr<NativeExec> sharedInstance();
   ~NativeExec();
 
@@ -47,9 +60,13 @@ public:
 
   void openUrl(const std::string& url, const std::string& target) override;
 
+  bool dispatchEvent(const std::string& event, std::shared_ptr<IVggEnv> env) override;
+
   using InjectFn = std::function<void(node::Environment*)>;
   bool inject(InjectFn fn);
 
+  TaskQueueStats taskQueueStats() const;
+
   void release();
 
 private:
@@ -25,9 +25,9 @@
 namespace VGG
 {
 
-class Timer;
 class LayoutNode;
 class AttrBridge;
+class AnimateManage;
 using std::chrono::milliseconds;
 using std::chrono::steady_clock;
 
@@ -69,8 +69,13 @@ public:
     override;
 };
 
+// The independent animations are advanced by the AnimateManage once per rendered frame, with the
+// timestamp of the frame, and their child animations are advanced with them. An animation starts
+// at the timestamp of the first frame it's advanced in.
 class Animate
 {
+  friend AnimateManage;
+
 public:
   Animate(milliseconds duration, milliseconds interval, std::shared_ptr<Interpolator> interpolator);
   Animate(Animate* parent);
@@ -103,13 +108,16 @@ public:
   const std::vector<std::shared_ptr<Animate>>& getChildAnimate();
   void                                         addChildAnimate(std::shared_ptr<Animate> child);
 
+private:
+  void advance(steady_clock::time_point now);
+
 private:
   std::optional<milliseconds>             m_duration;
   std::optional<milliseconds>             m_interval;
   std::shared_ptr<Interpolator>           m_interpolator;
   Animate*                                m_parent;
   std::vector<std::shared_ptr<Animate>>   m_childAnimates;
-  std::shared_ptr<Timer>                  m_timer;
+  bool                                    m_running{ false };
   std::optional<steady_clock::time_point> m_startTime;
   std::optional<steady_clock::time_point> m_lastTriggeredTime;
   std::vector<std::function<void()>>      m_callbackWhenStop;
@@ -125,7 +133,10 @@ public:
 
   bool hasRunningAnimation() const;
 
-private:
+  // Advances all the running animations to the same timestamp, it's called once per rendered frame
+  // so the animations are in step with the frames.
+  void advance(steady_clock::time_point now);
+
   // if animate is not isIndependent, then do nothing.
   void addAnimate(std::shared_ptr<Animate> animate);
 
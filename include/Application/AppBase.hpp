@@ -21,6 +21,7 @@
 
 #include "Layer/Graphics/GraphicsContext.hpp"
 #include "Layer/VGGLayer.hpp"
+#include "Utility/CappingProfiler.hpp"
 
 #include <memory>
 #include <optional>
@@ -70,6 +71,18 @@ namespace VGG::app
  * */
 HAS_MEMBER_FUNCTION_DEF(pollEvent)
 
+/*
+ * void waitEvent(std::optional<CappingProfiler::dms> timeout)
+ * Optional, blocks until the backends have events or the timeout expires
+ * */
+HAS_MEMBER_FUNCTION_DEF(waitEvent)
+
+/*
+ * void wakeUp()
+ * Optional, wakes up waitEvent from any thread
+ * */
+HAS_MEMBER_FUNCTION_DEF(wakeUp)
+
 #undef HAS_MEMBER_FUNCTION_DEF
 
 struct AppError
@@ -122,6 +135,7 @@ protected:
   AppConfig                      m_appConfig;
   bool                           m_shouldExit;
   bool                           m_init{ false };
+  bool                           m_needsRender{ true };
 
 private:
   std::optional<AppError> initInternal(AppConfig cfg)
@@ -136,6 +150,10 @@ private:
       {
         return AppError(AppError::EKind::RENDER_ENGINE_ERROR, "RENDER_ENGINE_ERROR");
       }
+      if constexpr (has_member_wakeUp<T>::value)
+      {
+        m_appRender->setWakeUp([this]() { Self()->wakeUp(); });
+      }
     }
     return std::nullopt;
   }
@@ -187,6 +205,7 @@ public: // public methods
 
   bool sendEvent(const UEvent& e)
   {
+    m_needsRender = true;
     auto handled = onGlobalEvent(e);
     if (!handled)
     {
@@ -228,11 +247,25 @@ public: // public methods
     Self()->pollEvent();
   }
 
+  // Waits for events instead of polling if the backend supports it
+  void wait(std::optional<CappingProfiler::dms> timeout)
+  {
+    if constexpr (has_member_waitEvent<T>::value)
+    {
+      Self()->waitEvent(timeout);
+    }
+    else
+    {
+      Self()->pollEvent();
+    }
+  }
+
   void process()
   {
     ASSERT(m_appRender);
     if (m_appRender->beginFrame(appConfig().renderFPSLimit))
     {
+      m_needsRender = false;
       m_appRender->render();
       m_appRender->endFrame();
     }
@@ -240,9 +273,19 @@ public: // public methods
 
   int exec()
   {
+    auto profiler = CappingProfiler::getInstance();
     while (!shouldExit())
     {
-      poll();
+      // Sleeps until the next event if there is nothing to render, the tiles rasterized in the
+      // background wake the loop up if the backend supports it. Otherwise sleeps until the next
+      // frame is allowed instead of spinning on the fps limit.
+      std::optional<CappingProfiler::dms> timeout;
+      if (m_needsRender ||
+          (m_appRender->hasPendingTiles() && !m_appRender->wakesUpOnRasterized()))
+      {
+        timeout = profiler->timeToNextFrame(appConfig().renderFPSLimit);
+      }
+      wait(timeout);
       process();
     }
     return 0;
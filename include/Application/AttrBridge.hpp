@@ -228,6 +228,7 @@ public:
 public:
   layer::PaintNode*       getPaintNode(std::shared_ptr<LayoutNode> node);
   std::shared_ptr<UIView> getView();
+  // The callers writing through the object must call Domain::Element::markModelChanged()
   static Model::Object*   getlayoutNodeObject(std::shared_ptr<LayoutNode> node);
 
 public:
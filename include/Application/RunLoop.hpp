@@ -17,7 +17,9 @@
 
 #include <chrono>
 #include <compare>
+#include <functional>
 #include <memory>
+#include <optional>
 #include <rxcpp/operators/rx-observe_on.hpp>
 #include <rxcpp/schedulers/rx-runloop.hpp>
 
@@ -29,6 +31,8 @@ class RunLoop
   rxcpp::schedulers::run_loop m_runLoop;
 
 public:
+  using Clock = rxcpp::schedulers::run_loop::clock_type;
+
   static std::shared_ptr<RunLoop> sharedInstance();
 
   rxcpp::observe_on_one_worker thread()
@@ -49,6 +53,29 @@ public:
     }
   }
 
+  // The time the earliest scheduled item is due, nullopt if nothing is scheduled
+  std::optional<Clock::time_point> nextDeadline() const
+  {
+    if (m_runLoop.empty())
+    {
+      return std::nullopt;
+    }
+    return m_runLoop.peek().when;
+  }
+
+  // Called, possibly on another thread, when an item is scheduled earlier than the ones before it,
+  // so a main loop blocked until the previous deadline can wake up to dispatch it.
+  void setWakeUp(std::function<void()> wakeUp)
+  {
+    if (!wakeUp)
+    {
+      m_runLoop.set_notify_earlier_wakeup({});
+      return;
+    }
+    m_runLoop.set_notify_earlier_wakeup([wakeUp = std::move(wakeUp)](const Clock::time_point&)
+                                        { wakeUp(); });
+  }
+
 private:
   RunLoop() = default;
 };
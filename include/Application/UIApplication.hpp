@@ -17,13 +17,16 @@
 
 #include <stdint.h>
 #include <memory>
+#include <optional>
 #include <vector>
 #include "Application/AppRender.hpp"
 #include "Application/Controller.hpp"
 #include "Event/EventListener.hpp"
+#include "Utility/CappingProfiler.hpp"
 #include "Utility/Log.hpp"
 namespace VGG
 {
+class RunLoop;
 class UIScrollView;
 namespace layer
 {
@@ -62,10 +65,17 @@ public:
   bool needsPaint();
   bool paint(int fps, bool force = false);
 
+  // How long the main loop may block waiting for events: until the next frame is allowed if a
+  // paint is needed and no wake up is expected, or not at all while the frames next to the current
+  // one are being built, bounded by the next item scheduled on the run loop. Returns nullopt if
+  // there is nothing to do until the next event.
+  std::optional<CappingProfiler::dms> idleTimeout(int fps, const RunLoop& runLoop);
+
   std::vector<uint8_t> makeImageSnapshot(layer::ImageOptions options);
 
 private:
   bool handleKeyEvent(VKeyboardEvent evt);
+  bool isDirty(); // needs paint regardless of the pending tiles
 };
 
 } // namespace VGG
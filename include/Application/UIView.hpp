@@ -33,8 +33,10 @@
 #include "Application/Event/EventListener.hpp"
 #include "Application/UIAnimation.hpp"
 #include "Application/UIOptions.hpp"
+#include "Domain/Layout/HitTestIndex.hpp"
 #include "Domain/Layout/LayoutContext.hpp"
 #include "Domain/Layout/Rect.hpp"
+#include "Domain/Loader.hpp"
 #include "Event/Event.hpp"
 #include "Layer/Core/FrameNode.hpp"
 #include "Layer/Memory/Ref.hpp"
@@ -72,7 +74,7 @@ class UIView : public app::EventListener
 {
 public:
   using EventListener = std::function<void(UIEventPtr, std::weak_ptr<LayoutNode>)>;
-  using ResourcesType = std::map<std::string, std::vector<char>>;
+  using ResourcesType = Model::Loader::ResourcesType;
   using HasEventListener = std::function<bool(const std::string&, EUIEventType)>;
 
   using ScalarType = int;
@@ -91,6 +93,7 @@ private:
     TargetNode                       mouseOutTargetNode;
     std::shared_ptr<VGG::LayoutNode> mouseOutNode;
     std::vector<TargetNode>          mouseLeaveTargetNodes; // enter nodes stack
+    HitTestIndex                     hitTestIndex;          // of the presented tree
   };
 
   EventListener    m_eventListener;
@@ -128,6 +131,7 @@ private:
   bool m_isDirty{ false };
   bool m_paintOnceMoreAfterAnimation{ false };
   bool m_skipUntilNextLoop{ false };
+  bool m_isWarmingUp{ false };
   bool m_isZoomerEnabled{ true };
   bool m_drawGrayBackground{ false };
 
@@ -138,6 +142,16 @@ public:
   ~UIView();
 
   void frame();
+  // Advances the running animations once for the frame being rendered
+  void advanceAnimations();
+
+  // Builds at most one of the frames next to the current one, isWarmingUp() stays true until
+  // there is nothing left to build
+  void warmUpPages();
+  bool isWarmingUp() const
+  {
+    return m_isWarmingUp;
+  }
 
   void show(
     std::shared_ptr<ViewModel>&                viewModel,
@@ -193,6 +207,11 @@ public:
   bool isDirty();
   void setDirty(const bool dirty)
   {
+    if (dirty)
+    {
+      invalidateHitTestIndexes(); // the frames of the nodes might be changed
+    }
+
     if (dirty == m_isDirty)
     {
       return;
@@ -334,6 +353,14 @@ private:
 
   bool handleTouchEvent(int x, int y, int motionX, int motionY, EUIEventType type);
 
+  TargetNode hitTest(
+    EventContext&                  eventContext,
+    LayoutNode&                    page,
+    const Layout::Point&           point,
+    const LayoutNode::HitTestHook& hasEventListener,
+    const LayoutNode*              node = nullptr);
+  void invalidateHitTestIndexes();
+
   void restoreState(const std::string& instanceId);
 
   void show(
@@ -0,0 +1,66 @@
+/*
+ * Copyright 2023-2024 VeryGoodGraphics LTD <bd@verygoodgraphics.com>
+ *
+ * Licensed under the VGG License, Version 1.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.verygoodgraphics.com/licenses/LICENSE-1.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace VGG
+{
+namespace Model
+{
+
+// Immutable content of a file, which is shared from the loader to the renderer without copying.
+class Blob
+{
+public:
+  virtual ~Blob() = default;
+
+  virtual const char* data() const = 0;
+  virtual std::size_t size() const = 0;
+};
+
+using BlobPtr = std::shared_ptr<const Blob>;
+
+class VectorBlob final : public Blob
+{
+  std::vector<char> m_data;
+
+public:
+  explicit VectorBlob(std::vector<char>&& data)
+    : m_data{ std::move(data) }
+  {
+  }
+
+  const char* data() const override
+  {
+    return m_data.data();
+  }
+
+  std::size_t size() const override
+  {
+    return m_data.size();
+  }
+};
+
+inline BlobPtr makeBlob(std::vector<char>&& data)
+{
+  return std::make_shared<VectorBlob>(std::move(data));
+}
+
+} // namespace Model
+} // namespace VGG
@@ -67,7 +67,6 @@ class Daruma
   MakeJsonDocFn                m_makeDesignDocFn;
   JsonDocumentPtr              m_layoutDoc;
   MakeJsonDocFn                m_makeLayoutDocFn;
-  Model::Loader::ResourcesType m_resources;
   nlohmann::json               m_settingsDoc;
 
   // runtime view model, symbol instance expanded
@@ -84,7 +83,9 @@ public:
   Daruma(const MakeJsonDocFn& makeDesignDocFn, const MakeJsonDocFn& makeLayoutDocFn = {});
   ~Daruma();
 
-  bool load(const std::string& path);   // zip file or dir
+  // zip file or dir, the files of a dir are memory mapped if mapFiles, they must not be modified
+  // until the model is released
+  bool load(const std::string& path, bool mapFiles = false);
   bool load(std::vector<char>& buffer); // zip buffer
 
   void accept(VGG::Model::Visitor* visitor);
@@ -96,10 +97,10 @@ public:
 
   JsonDocumentPtr& designDoc();
   JsonDocumentPtr& layoutDoc();
-  auto             resources()
-  {
-    return m_resources;
-  }
+
+  // Resources are read from the package on demand, readResource() is thread safe
+  std::vector<std::string> resourceNames() const;
+  Model::BlobPtr           readResource(const std::string& name) const;
 
   std::string docVersion() const;
 
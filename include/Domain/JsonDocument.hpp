@@ -34,8 +34,14 @@ public:
   virtual ~JsonDocument() = default;
 
   virtual json content() const;
+  // Returns the content without copying it, the reference is valid until the document is changed
+  virtual const json& contentView() const;
   virtual void setContent(const json& document);
 
+  // Returns the value at the path, throws like json::at() if the path does not exist. The
+  // documents could resolve the path without building the whole content.
+  virtual json valueAt(const json::json_pointer& path) const;
+
   virtual void addAt(const std::string& path, const std::string& value);
   virtual void replaceAt(const std::string& path, const std::string& value);
   virtual void deleteAt(const std::string& path);
@@ -0,0 +1,87 @@
+/*
+ * Copyright 2023-2024 VeryGoodGraphics LTD <bd@verygoodgraphics.com>
+ *
+ * Licensed under the VGG License, Version 1.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.verygoodgraphics.com/licenses/LICENSE-1.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "Domain/Layout/LayoutNode.hpp"
+#include "Domain/Layout/Rect.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace VGG
+{
+
+// A flattened copy of a layout tree with the world space frames of the nodes, used to answer the
+// hit tests of a page without walking the ancestors of every node.
+//
+// A node is only hit inside its own frame, so the frame of a node bounds its whole subtree and the
+// tree is its own bounding volume hierarchy. The nodes are stored in pre-order with the children
+// front to back, a missed node skips its subtree and the query stops at the first hit.
+//
+// The index is built lazily on the first query and must be invalidated whenever the frames or the
+// structure of the tree change.
+class HitTestIndex
+{
+public:
+  using Result = std::pair<std::shared_ptr<LayoutNode>, std::string>;
+
+  void invalidate();
+  bool isValid(const LayoutNode* root) const
+  {
+    return m_root == root;
+  }
+
+  // Same as root.hitTest(), or node.hitTest() if a descendant node of the root is given
+  Result hitTest(
+    LayoutNode&                    root,
+    const Layout::Point&           point,
+    const LayoutNode::HitTestHook& hasEventListener,
+    const LayoutNode*              node = nullptr);
+
+  std::size_t size() const
+  {
+    return m_entries.size();
+  }
+
+private:
+  struct Entry
+  {
+    std::shared_ptr<LayoutNode> node;
+    Layout::Rect                frame; // world space
+    std::size_t                 end;   // index after the subtree
+  };
+
+  void build(LayoutNode& root);
+  void append(
+    const std::shared_ptr<LayoutNode>& node,
+    const LayoutNode*                  parent,
+    Layout::Point                      offset);
+
+  Result hitTest(
+    std::size_t                    index,
+    const Layout::Point&           point,
+    const LayoutNode::HitTestHook& hasEventListener) const;
+
+  const LayoutNode*                                  m_root{ nullptr };
+  std::vector<Entry>                                 m_entries;
+  std::unordered_map<const LayoutNode*, std::size_t> m_indexes;
+};
+
+} // namespace VGG
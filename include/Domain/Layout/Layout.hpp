@@ -54,7 +54,7 @@ private:
   RuleMapPtr                              m_rules;
   std::vector<Size>                       m_originalPageSize;
 
-  std::unordered_map<std::string, LayoutNode*> m_nodeCacheMap; // id: node
+  std::unordered_map<std::string, std::weak_ptr<LayoutNode>> m_nodeCacheMap; // id: node
 
 public:
   Layout(JsonDocumentPtr designDoc, JsonDocumentPtr layoutDoc);
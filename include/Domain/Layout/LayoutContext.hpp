@@ -37,6 +37,11 @@ public:
   virtual void didUpdateBounds(LayoutNode* node) = 0;
   virtual void didUpdateMatrix(LayoutNode* node) = 0;
   virtual void didUpdateContourPoints(LayoutNode* node) = 0;
+
+  // True if any update notified since the last reset could not be patched into the rendered scene,
+  // which has to be rebuilt from the model then.
+  virtual bool needsRebuildScene() const = 0;
+  virtual void setNeedsRebuildScene(bool needs) = 0;
 };
 
 } // namespace VGG
\ No newline at end of file
@@ -119,7 +119,9 @@ public:
   std::pair<std::shared_ptr<LayoutNode>, std::string> hitTest(
     const Layout::Point& point,
     const HitTestHook&   hasEventListener);
-  virtual bool shouldHandleEvents() const
+  // Returns the key of the listener if the node handles the events, an empty key if no hook given
+  std::optional<std::string> hitTestKey(const HitTestHook& hasEventListener) const;
+  virtual bool               shouldHandleEvents() const
   {
     return true;
   }
@@ -185,6 +187,12 @@ public:
   bool hasNeedsLayoutDescendant() const;
   void layoutIfNeeded(LayoutContext* context = nullptr);
 
+  // The updates of the subtree are notified to the context until it's reset with nullptr
+  void setContext(LayoutContext* context)
+  {
+    m_context = context;
+  }
+
   std::shared_ptr<LayoutNode> scaleTo(
     const Layout::Size& newSize,
     bool                updateRule,
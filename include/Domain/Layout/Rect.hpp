@@ -102,7 +102,7 @@ struct Rect
   Point origin;
   Size  size;
 
-  bool contains(Point point)
+  bool contains(Point point) const
   {
     return (point.x >= origin.x && point.x <= (origin.x + size.width)) &&
            (point.y >= origin.y && point.y <= (origin.y + size.height));
@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include "Blob.hpp"
 #include "Config.hpp"
 
 #include <map>
@@ -29,11 +30,16 @@ namespace Model
 class Loader
 {
 public:
-  using ResourcesType = std::map<std::string, std::vector<char>>;
+  using ResourcesType = std::map<std::string, BlobPtr>;
 
   virtual ~Loader() = default;
   virtual bool readFile(const std::string& name, std::string& content) const = 0;
-  virtual ResourcesType resources() const = 0;
+
+  // Names of the files under the resources directory, nothing is decompressed or read
+  virtual std::vector<std::string> resourceNames() const = 0;
+  // Reads one file of the package on demand, returns nullptr if it does not exist. Must be thread
+  // safe.
+  virtual BlobPtr readBlob(const std::string& name) const = 0;
 };
 
 } // namespace Model
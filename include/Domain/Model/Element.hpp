@@ -18,8 +18,10 @@
 
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <stack>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 #include "DesignModelFwd.hpp"
@@ -184,13 +186,23 @@ public:
 
     child->m_parent = weak_from_this();
     m_children.push_back(child);
+    markTreeChanged();
   }
 
   auto clearChildren()
   {
+    markTreeChanged();
     return std::move(m_children);
   }
 
+  // The revisions are bumped whenever the elements change, the indexes and the snapshots built
+  // from the elements are rebuilt when they're changed. The tree revision covers the children, the
+  // ids and the names; the model revision covers any change of the models.
+  static unsigned treeRevision();
+  static void     markTreeChanged();
+  static unsigned modelRevision();
+  static void     markModelChanged();
+
   virtual void buildSubtree()
   {
   }
@@ -257,6 +269,14 @@ public:
   {
     return m_designModel;
   }
+
+private:
+  void buildKeyIndex();
+  void buildKeyIndex(const std::shared_ptr<Element>& element);
+
+  // id or name -> the first element in pre-order which has the key
+  std::unordered_map<std::string, std::weak_ptr<Element>> m_keyIndex;
+  std::optional<unsigned>                                 m_keyIndexRevision;
 };
 
 class FrameElement : public Element
@@ -30,6 +30,14 @@ public:
   {
     return m_doc;
   }
+  const json& contentView() const override
+  {
+    return m_doc;
+  }
+  json valueAt(const json::json_pointer& path) const override
+  {
+    return m_doc.at(path);
+  }
 
   virtual void addAt(const json::json_pointer& path, const json& value) override
   {
@@ -32,6 +32,14 @@ public:
   {
     return m_doc.json_const_ref();
   }
+  const json& contentView() const override
+  {
+    return m_doc.json_const_ref();
+  }
+  json valueAt(const json::json_pointer& path) const override
+  {
+    return m_doc.json_const_ref().at(path);
+  }
 
   virtual void addAt(const json::json_pointer& path, const json& value) override
   {
@@ -38,6 +38,9 @@ public:
   bool evalModule(const std::string& script);
   bool evalModule(const std::string& code, VGG::EventPtr event);
 
+  // Sends the event json to the listener of the env
+  bool dispatchEvent(const std::string& event);
+
   void openUrl(const std::string& url, const std::string& target);
 
 private:
@@ -38,6 +38,13 @@ public:
     std::shared_ptr<IVggEnv> env) = 0;
 
   virtual void openUrl(const std::string& url, const std::string& target) = 0;
+
+  // Calls the event listener of the env with the event json, without compiling a script for each
+  // event. Returns false if it's not supported by the engine, a script is evaluated instead then.
+  virtual bool dispatchEvent(const std::string& event, std::shared_ptr<IVggEnv> env)
+  {
+    return false;
+  }
 };
 
 } // namespace VGG
@@ -15,6 +15,8 @@
  */
 #pragma once
 
+#include "Blob.hpp"
+
 #include <cstddef>
 #include <string>
 #include <vector>
@@ -32,6 +34,11 @@ public:
     visit(path, std::vector<char>(content.begin(), content.end()));
   }
 
+  void visit(const std::string& path, const Blob& content)
+  {
+    visit(path, std::vector<char>(content.data(), content.data() + content.size()));
+  }
+
   virtual void visit(const std::string& path, const std::vector<char>& content) = 0;
 };
 
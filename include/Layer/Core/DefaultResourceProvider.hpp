@@ -21,7 +21,6 @@
 #include <core/SkData.h>
 #include <string_view>
 #include <string>
-#include <fstream>
 #include <filesystem>
 
 namespace VGG::layer
@@ -48,23 +47,15 @@ public:
 
   Blob readData(std::string_view guid) override
   {
-    auto          filename = m_cwd / guid;
-    std::ifstream in(filename, std::ios::binary);
-    if (in.is_open() == false)
+    auto filename = m_cwd / guid;
+    // the file is memory mapped, the data is not copied
+    auto data = SkData::MakeFromFileName(filename.string().c_str());
+    if (!data)
     {
       VGG_LOG_DEV(LOG, ResourceProvider, "cannot open {}", filename.string());
       return nullptr;
     }
-    in.seekg(0, std::ios::end);
-    const auto length = in.tellg();
-    in.seekg(0, std::ios::beg);
-    char* data = (char*)malloc(length);
-    if (!in.read(data, length))
-    {
-      VGG_LOG_DEV(LOG, ResourceProvider, "read data failed");
-      return nullptr;
-    }
-    return SkData::MakeFromMalloc(data, length);
+    return data;
   }
 
 private:
@@ -20,6 +20,8 @@
 #include "Layer/Core/VBounds.hpp"
 #include "Utility/HelperMacro.hpp"
 
+#include <functional>
+
 class SkPicture;
 template<typename T>
 class sk_sp;
@@ -50,9 +52,29 @@ class FrameNode final : public TransformEffectNode
   VGG_DECL_IMPL(FrameNode);
 
 public:
+  using Builder = std::function<PaintNodePtr()>;
+
   FrameNode(VRefCnt* cnt, Ref<TransformNode> transform, PaintNodePtr root);
+
+  // The paint node tree of the frame is made by the builder when it's first needed. Only the guid,
+  // unique id and visibility of the root node are known before that.
+  FrameNode(
+    VRefCnt*           cnt,
+    Ref<TransformNode> transform,
+    Builder            builder,
+    std::string        guid,
+    int                uniqueID,
+    bool               visible);
+
   const std::string& guid() const;
-  PaintNode*         node() const;
+  int                uniqueID() const;
+  PaintNode*         node() const; // builds the paint node tree if needed
+
+  bool isBuilt() const;
+
+  // Releases the paint node tree of a frame made with a builder, it will be built again from the
+  // model when needed. Updates only applied to the paint nodes are lost.
+  void release();
 
   TransformNode* getTransformNode()
   {
@@ -67,6 +89,7 @@ public:
 
   void invalidateMask(); // temporary solution
 
+  void setVisible(bool visible);
   bool isVisible() const;
 
   void render(Renderer* renderer) override;
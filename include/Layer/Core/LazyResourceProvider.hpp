@@ -0,0 +1,55 @@
+/*
+ * Copyright 2023-2024 VeryGoodGraphics LTD <bd@verygoodgraphics.com>
+ *
+ * Licensed under the VGG License, Version 1.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.verygoodgraphics.com/licenses/LICENSE-1.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include "Layer/Core/ResourceProvider.hpp"
+#include <core/SkData.h>
+#include <atomic>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+namespace VGG::layer
+{
+// Reads the resources through the fetcher when an image is first asked for, the fetched blobs are
+// kept so that an evicted image can be decoded again without reading the package.
+class LazyResourceProvider : public ResourceProvider
+{
+public:
+  using Fetcher = std::function<Blob(std::string_view guid)>;
+
+  LazyResourceProvider(Fetcher fetcher);
+  LazyResourceProvider(const LazyResourceProvider&) = delete;
+  LazyResourceProvider& operator=(const LazyResourceProvider&) = delete;
+  ~LazyResourceProvider() override;
+
+  // Fetches the resources on a background thread, the previous warm-up is cancelled
+  void warmUp(std::vector<std::string> guids);
+
+  void purge();
+  Blob readData(std::string_view guid) override;
+
+private:
+  void cancelWarmUp();
+
+  Fetcher                               m_fetcher;
+  std::mutex                            m_mutex;
+  std::unordered_map<std::string, Blob> m_data;
+  std::future<void>                     m_warmUp;
+  std::atomic_bool                      m_cancelWarmUp{ false };
+};
+} // namespace VGG::layer
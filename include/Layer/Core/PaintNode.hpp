@@ -234,6 +234,15 @@ public:
 #endif
 
 public:
+  // A cache boundary keeps the picture recorded from its subtree, which is drawn as it is until
+  // the node is revalidated. The subtree must not be masked by the nodes out of it.
+  void setCacheBoundary(bool enabled);
+  bool isCacheBoundary() const;
+
+  // The bounds covering the effects like the drop shadows in the parent space, which are updated
+  // on revalidation.
+  Bounds effectBounds() const;
+
   void                  render(Renderer* renderer);
   void                  setVisible(bool visible);
   bool                  isVisible() const;
@@ -255,6 +264,10 @@ public:
   using NodeVisitor = void (*)(PaintNode*, const NodeAtContext* ctx);
   void nodeAt(int x, int y, NodeVisitor, void* userData);
 
+  // Returns the front-most node at the point, the children are tested front to back and the
+  // traversal stops at the first hit.
+  PaintNode* nodeAt(int x, int y);
+
   ~PaintNode();
 
 protected:
@@ -282,6 +295,8 @@ protected:
 #endif
 
 private:
+  void renderContent(Renderer* renderer);
+
   ChildContainer     m_children;
   WeakRef<PaintNode> m_parent;
 
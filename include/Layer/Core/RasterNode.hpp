@@ -52,6 +52,12 @@ public:
 
   virtual void raster(const std::vector<Bounds>& bounds) = 0;
 
+  // Returns true if placeholders were drawn in the last render for the tiles being rasterized
+  virtual bool hasPendingTiles() const
+  {
+    return false;
+  }
+
   const glm::mat3& getRasterMatrix() const
   {
     ASSERT(!isInvalid());
@@ -118,6 +124,8 @@ private:
   RasterManager::RasterExecutor* m_executor{ nullptr };
 };
 
+// Merges the damaged bounds only where the union costs no more area than the bounds themselves, so
+// the damages far from each other are redrawn separately, in a bounded number of rects.
 std::vector<Bounds> mergeBounds(std::vector<Bounds> bounds);
 
 } // namespace VGG::layer
@@ -44,6 +44,9 @@ public:
 
   PaintNode* nodeByID(int id);
 
+  // Finds the frame by the unique id of its root node, the frame is not built
+  FrameNode* frameByID(int id) const;
+
   Bounds effectBounds() const override;
 
   Bounds onRevalidate(Revalidation* inv, const glm::mat3 & mat) override;
@@ -21,7 +21,9 @@
 #include "Domain/Layout/ExpandSymbol.hpp"
 #include "Domain/Layout/Layout.hpp"
 #include "Domain/RawJsonDocument.hpp"
+#include "Layer/DocSnapshot.hpp"
 
+#include <filesystem>
 #include <memory>
 #include <nlohmann/json.hpp>
 #include <Utility/Log.hpp>
@@ -45,6 +47,8 @@ class DocBuilder
   Model::DesignModel m_docModel;
   bool               m_invalid{ false };
 
+  std::filesystem::path m_snapshotDir; // no snapshot if empty
+
   void moveToThis(DocBuilder&& that) noexcept
   {
     ASSERT(!that.m_invalid);
@@ -53,6 +57,7 @@ class DocBuilder
     m_layout = std::move(that.m_layout);
     m_doc = std::move(that.m_doc);
     m_docModel = std::move(that.m_docModel);
+    m_snapshotDir = std::move(that.m_snapshotDir);
     m_invalid = std::move(that.m_invalid);
     that.m_invalid = true;
   }
@@ -117,11 +122,36 @@ public:
   {
     SET_BUILDER_OPTION(m_enableLayout, enabled);
   }
+  // The expanded document is loaded from the snapshot in the directory if the inputs are not
+  // changed, or saved to it after being built.
+  DocBuilder setSnapshotDir(std::filesystem::path dir)
+  {
+    SET_BUILDER_OPTION(m_snapshotDir, dir);
+  }
 
   Result build()
   {
     ASSERT(!m_invalid);
     Result::TimeCost cost;
+    if (m_enableExpand && !m_snapshotDir.empty())
+    {
+      std::shared_ptr<VGG::Domain::DesignDocument> d;
+      cost.expand = layer::Timer::time(
+        [&, this]()
+        {
+          const auto key = DocSnapshot::key(m_doc, m_layout);
+          d = DocSnapshot::load(m_snapshotDir, key);
+          if (!d)
+          {
+            auto e = Layout::ExpandSymbol(m_doc, m_layout);
+            e();
+            d = e.layout()->designDocTree();
+            DocSnapshot::save(m_snapshotDir, key, *d);
+          }
+        });
+      m_invalid = true;
+      return { cost, std::move(d) };
+    }
     if (m_enableExpand)
     {
       auto d = std::shared_ptr<VGG::Domain::DesignDocument>();
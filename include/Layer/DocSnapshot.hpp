@@ -0,0 +1,59 @@
+/*
+ * Copyright 2023-2024 VeryGoodGraphics LTD <bd@verygoodgraphics.com>
+ *
+ * Licensed under the VGG License, Version 1.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.verygoodgraphics.com/licenses/LICENSE-1.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include <nlohmann/json.hpp>
+
+#include <filesystem>
+#include <memory>
+#include <string>
+
+namespace VGG::Domain
+{
+class DesignDocument;
+} // namespace VGG::Domain
+
+namespace VGG::entry
+{
+
+// A binary snapshot of an expanded and laid out design document, keyed by a digest of the design
+// and layout json it's built from and of the build of the library. The snapshot stores the tree
+// model in CBOR, the expanded instances are stored in their flattened form, the same as the
+// display document.
+class DocSnapshot
+{
+public:
+  // Must be bumped whenever the format of the snapshot changes
+  static constexpr int VERSION = 1;
+
+  // The MD5 of the serialized inputs, the git revision of the build and the supported format
+  // version, so a snapshot is never loaded by another build, whose expansion might differ. Unlike
+  // std::hash, it's stable across runs, and 128 bits make a collision unlikely.
+  static std::string key(const nlohmann::json& design, const nlohmann::json& layout);
+
+  static std::filesystem::path path(const std::filesystem::path& dir, const std::string& key);
+
+  // Returns null if there is no valid snapshot of the key in the directory
+  static std::shared_ptr<Domain::DesignDocument> load(
+    const std::filesystem::path& dir,
+    const std::string&           key);
+
+  static void save(
+    const std::filesystem::path&  dir,
+    const std::string&            key,
+    const Domain::DesignDocument& doc);
+};
+
+} // namespace VGG::entry
@@ -22,8 +22,24 @@
 
 #include <core/SkSurface.h>
 #include <core/SkCanvas.h>
+#include <core/SkPicture.h>
+
+namespace VGG::layer
+{
+class FrameNode;
+}
 
 namespace VGG::layer::exporter
 {
 std::optional<std::vector<char>> makeImage(const ImageOptions& opts, SkSurface* surface);
+
+// Records the frame in its own coordinates, must be called on the thread owning the scene
+sk_sp<SkPicture> makePicture(layer::FrameNode* frame);
+
+// Rasterizes the picture scaled by scale on a cpu surface and encodes it. It's thread safe, so the
+// frames recorded by makePicture could be exported concurrently.
+std::optional<std::vector<char>> makeImage(
+  const ImageOptions& opts,
+  const SkPicture*    picture,
+  float               scale);
 } // namespace VGG::layer::exporter
@@ -16,12 +16,56 @@
 
 #pragma once
 
+#include <cstddef>
+
 namespace VGG::layer
 {
 
 bool isAnimatedPatternEnabled();
 void setAnimatedPatternEnabled(bool enable);
 
+// The number of worker threads used to rasterize tiles. 0 means rasterizing on the render thread
+// with the gpu context, otherwise tiles are rasterized concurrently by the cpu backend. It takes
+// effect on the next VLayer::setRenderNode call. Unless it's set, it's read from "threadCount" of
+// the "raster" object of the global config on first use, or one less than the hardware threads.
+int  rasterThreadCount();
+void setRasterThreadCount(int count);
+
+struct RasterCacheStats
+{
+  size_t budgetBytes{ 0 };
+  size_t usedBytes{ 0 };
+  size_t evictionCount{ 0 };
+  size_t evictedBytes{ 0 };
+  size_t purgeCount{ 0 };
+};
+
+// The memory budget in bytes shared by the tile caches of all the raster nodes
+size_t rasterCacheBudget();
+void   setRasterCacheBudget(size_t bytes);
+
+RasterCacheStats rasterCacheStats();
+
+// The damage redrawn on the tiles by all the raster nodes, the areas are in raster pixels
+struct DamageStats
+{
+  size_t updateCount{ 0 }; // damage updates of the tiles
+  size_t rectCount{ 0 };   // rects redrawn after merging
+  double damagedArea{ 0 }; // the sum of the areas of the damaged rects
+  double rasterArea{ 0 };  // the area actually redrawn
+
+  double overdrawRatio() const
+  {
+    return damagedArea > 0 ? rasterArea / damagedArea : 1.0;
+  }
+};
+
+DamageStats damageStats();
+void        resetDamageStats();
+
+// Releases cached tiles until at most targetBytes are used, e.g. on a memory pressure warning
+void purgeRasterCache(size_t targetBytes = 0);
+
 void setupEnv();
 
 } // namespace VGG::layer
@@ -376,6 +376,26 @@ struct Serde
     return from<typename M::Model, typename M::CastObject>(m, totalMatrix, ctx);
   }
 
+  // Same as the bounds of the paint node made from the model, mapped by its transform
+  template<typename T>
+    requires AbstractObject<T>
+  static Bounds transformedBounds(const T& m, const glm::mat3& totalMatrix)
+  {
+    auto [originalMatrix, newMatrix, inversedNewMatrix] = Serde::makeMatrix(m.getMatrix());
+    auto bounds = m.getBounds();
+    CoordinateConvert::convertCoordinateSystem(
+      bounds,
+      inversedNewMatrix * totalMatrix * originalMatrix);
+    return bounds.map(newMatrix);
+  }
+
+  // Visits the fonts used by the texts in the model without making the paint nodes
+  template<typename M>
+  static void visitFontNames(const typename M::Model& m, const FontNameVisitor& visitor)
+  {
+    visitFontNames<typename M::Model, typename M::CastObject>(m, visitor);
+  }
+
   template<typename M>
   static std::vector<PaintNodePtr> from(
     const std::vector<typename M::Model>& models,
@@ -391,6 +411,24 @@ struct Serde
   }
 
 private:
+  template<typename T, typename C>
+    requires layer::AbstractObject<T> && CastObject<C, T>
+  static void visitFontNames(const T& m, const FontNameVisitor& visitor)
+  {
+    if (m.getObjectType() == EModelObjectType::TEXT)
+    {
+      for (const auto& style : C::asText(m).getOverrideFontAttr())
+      {
+        visitor(style.font.fontName, style.font.subFamilyName);
+      }
+      return;
+    }
+    for (const auto& c : m.getChildObjects())
+    {
+      visitFontNames<typename T::BaseType, C>(c, visitor);
+    }
+  }
+
   template<typename T, typename C>
     requires layer::AbstractObject<T> && CastObject<C, T>
   static PaintNodePtr dispatchObject(const T& m, const glm::mat3& totalMatrix, const Context& ctx)
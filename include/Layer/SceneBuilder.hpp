@@ -87,6 +87,13 @@ public:
     SET_BUILDER_OPTION(m_alloc, allocator);
   };
 
+  // Makes the paint nodes of a frame when it's first rendered or hit-tested, the models must
+  // outlive the frames.
+  SceneBuilder setLazyBuildEnable(bool enable)
+  {
+    SET_BUILDER_OPTION(m_lazyBuild, enable);
+  }
+
   template<typename M>
   SceneBuilderResult build(std::vector<typename M::Model> objects)
   {
@@ -94,6 +101,13 @@ public:
 
     glm::mat3 mat = glm::identity<glm::mat3>();
     mat = glm::scale(mat, glm::vec2(1, -1));
+    if (m_lazyBuild)
+    {
+      result.root = buildLazy<M>(std::move(objects), mat);
+      m_invalid = true;
+      return result;
+    }
+
     Serde::Context ctx;
     ctx.alloc = m_alloc;
     ctx.fontNameVisitor = m_fontNameVisitor;
@@ -111,6 +125,8 @@ public:
           bounds = bounds.map(p->getTransform().matrix());
           mat = glm::translate(mat, glm::vec2(-bounds.x(), -bounds.y()));
         }
+        // The masks are resolved within a frame, so its root can keep the recorded picture
+        p->setCacheBoundary(true);
         auto frame = FrameNode::Make(Matrix::Make(mat), std::move(p));
         result.root->emplace_back(frame);
       }
@@ -120,11 +136,50 @@ public:
   }
 
 private:
+  template<typename M>
+  std::optional<RootArray> buildLazy(std::vector<typename M::Model> objects, const glm::mat3& mat)
+  {
+    if (objects.empty())
+      return std::nullopt;
+
+    RootArray frames;
+    for (auto& object : objects)
+    {
+      if (m_fontNameVisitor)
+        Serde::visitFontNames<M>(object, m_fontNameVisitor);
+
+      glm::mat3 frameMatrix = glm::identity<glm::mat3>();
+      if (m_resetOrigin)
+      {
+        const auto bounds = Serde::transformedBounds(object, mat);
+        frameMatrix = glm::translate(frameMatrix, glm::vec2(-bounds.x(), -bounds.y()));
+      }
+      auto guid = object.getId();
+      auto id = object.getUniqueId();
+      auto visible = object.getVisible();
+      FrameNode::Builder builder = [object = std::move(object), mat, alloc = m_alloc]()
+      {
+        auto root = Serde::from<M>(object, mat, Serde::Context{ alloc, nullptr });
+        if (root)
+          root->setCacheBoundary(true);
+        return root;
+      };
+      frames.emplace_back(FrameNode::Make(
+        Matrix::Make(frameMatrix),
+        std::move(builder),
+        std::move(guid),
+        id,
+        visible));
+    }
+    return frames;
+  }
+
   std::vector<PaintNodePtr> m_frames;
 
   std::optional<std::string> m_version;
   bool                       m_invalid{ false };
   bool                       m_resetOrigin{ false };
+  bool                       m_lazyBuild{ false };
   VAllocator*                m_alloc{ nullptr };
 
   FontNameVisitor m_fontNameVisitor;
@@ -135,6 +190,7 @@ private:
     m_frames = std::move(that.m_frames);
     m_version = std::move(that.m_version);
     m_resetOrigin = std::move(that.m_resetOrigin);
+    m_lazyBuild = std::move(that.m_lazyBuild);
     m_alloc = std::move(that.m_alloc);
     m_invalid = std::move(that.m_invalid);
     m_fontNameVisitor = std::move(that.m_fontNameVisitor);
@@ -25,6 +25,7 @@
 #include "Layer/Effects.hpp"
 #include "Layer/Graphics/GraphicsLayer.hpp"
 
+#include <functional>
 #include <vector>
 class SkCanvas;
 class SkPicture;
@@ -84,6 +85,17 @@ public:
   void setDebugModeEnabled(bool enable);
   bool debugModeEnabled();
 
+  // Returns true if the tiles rendered in the last frame are still being rasterized and
+  // placeholders were drawn instead, so another frame is needed once they are ready.
+  bool hasPendingTiles() const;
+
+  // The wake up is called on a raster thread whenever a tile is rasterized in the background, so
+  // a loop could sleep while the tiles are pending instead of polling hasPendingTiles().
+  void setWakeUp(std::function<void()> wakeUp);
+
+  // Returns true if the pending tiles are rasterized in the background and the wake up is set
+  bool wakesUpOnRasterized() const;
+
   void drawPosition(int x, int y)
   {
     m_position[0] = x;
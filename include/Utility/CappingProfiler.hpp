@@ -16,8 +16,10 @@
 #ifndef __CAPPING_PROFILER_HPP__
 #define __CAPPING_PROFILER_HPP__
 
+#include <algorithm>
 #include <array>
 #include <chrono>
+#include <cstdint>
 #include <stdio.h>
 
 namespace VGG
@@ -57,6 +59,15 @@ public:
     }
   };
 
+  // Frame pacing of the main loop, the durations are in milliseconds
+  struct Stats
+  {
+    uint64_t frames{ 0 };
+    uint64_t wakeUps{ 0 }; // times the main loop woke up from waiting
+    double   idleDuration{ 0 };
+    double   averageFrameDuration{ 0 };
+  };
+
   static CappingProfiler* getInstance()
   {
     static CappingProfiler profiler;
@@ -70,12 +81,37 @@ public:
     return (d.count() > 1000. / fps);
   }
 
+  // The time left until a frame may be rendered under the fps limit
+  inline dms timeToNextFrame(double fps = 60.)
+  {
+    if (fps <= 0)
+    {
+      return dms{ 0 };
+    }
+    dms d = clock::now() - m_timestamp;
+    return std::max(dms{ 1000. / fps } - d, dms{ 0 });
+  }
+
   inline void markFrame()
   {
     tps now = clock::now();
     dms d = now - m_timestamp;
     m_durations.push_back(d.count());
     m_timestamp = now;
+    m_stats.frames++;
+  }
+
+  inline void markWakeUp(dms idle)
+  {
+    m_stats.wakeUps++;
+    m_stats.idleDuration += idle.count();
+  }
+
+  inline Stats stats() const
+  {
+    auto stats = m_stats;
+    stats.averageFrameDuration = m_durations.average();
+    return stats;
   }
 
   inline const char* fpsStr()
@@ -88,6 +124,7 @@ public:
 private:
   RingBuffer<double, 20> m_durations;
   tps m_timestamp;
+  Stats m_stats;
 
   CappingProfiler()
     : m_timestamp(clock::now())
@@ -65,7 +65,7 @@ class Exporter
   friend class ImageIteratorImpl;
 
 public:
-  Exporter();
+  Exporter(EBackend backend = EBackend::VULKAN);
   void info(ExporterInfo* info);
 
   ImageIterator render(
@@ -80,6 +80,15 @@ public:
     };
   }
 
+  // Exports the images of all the frames through the output callback, in completion order if
+  // imageOpt.threadCount > 0. Stops once the callback returns false. Returns the number of images.
+  int exportImages(
+    nlohmann::json      design,
+    nlohmann::json      layout,
+    const ImageOption&  imageOpt,
+    const ExportOption& exporterOpt,
+    BuilderResult&      result);
+
   void setOutputCallback(OutputCallback callback);
   ~Exporter();
 };
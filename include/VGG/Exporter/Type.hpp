@@ -73,11 +73,16 @@ struct ImageOption
   int        imageQuality = 100;
   SizePolicy size = ScaleDetermine{ 1.f };
   EImageType type{ EImageType::PNG };
+  // 0 renders and encodes the frames one by one on the gpu surface. Otherwise the frames are
+  // recorded on the calling thread and rasterized on cpu surfaces then encoded by threadCount
+  // workers, while the next frames are being recorded.
+  int threadCount = 0;
 };
 
 enum class EBackend
 {
   VULKAN,
+  RASTER, // skia cpu raster pipeline, for the machines without gpu
 };
 
 class IteratorResult
@@ -178,6 +183,9 @@ struct ExportOption
 {
   bool enableExpand{ true };
   bool enableLayout{ true };
+  // The expanded documents are cached in the directory and reused while the inputs are not
+  // changed, no cache if empty
+  std::string snapshotDir;
 };
 
 } // namespace VGG::exporter
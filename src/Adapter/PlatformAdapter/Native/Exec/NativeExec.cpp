@@ -92,6 +92,19 @@ bool NativeExec::evalModule(
   return m_impl->schedule_eval(wrapped_script);
 }
 
+bool NativeExec::dispatchEvent(const std::string& event, std::shared_ptr<IVggEnv> env)
+{
+  NativeEventTarget target;
+  target.m_container_key = env->getContainerKey();
+  target.m_env_key = env->getEnv();
+  target.m_instance_key = env->getInstanceKey();
+  target.m_current_env_name = env->currrentEnvName();
+  target.m_current_vgg_name = env->currrentVggName();
+  target.m_listener_key = env->getListenerKey();
+
+  return m_impl->schedule_dispatch(std::move(target), event);
+}
+
 bool NativeExec::inject(InjectFn fn)
 {
   auto env = m_impl->getNodeEnv();
@@ -103,6 +116,11 @@ bool NativeExec::inject(InjectFn fn)
   return false;
 }
 
+NativeExec::TaskQueueStats NativeExec::taskQueueStats() const
+{
+  return m_impl->task_queue_stats();
+}
+
 void NativeExec::teardown()
 {
   m_impl->notify_node_thread_to_stop();
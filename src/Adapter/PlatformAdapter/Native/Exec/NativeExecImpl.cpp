@@ -17,17 +17,23 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <iostream>
+#include <algorithm>
+#include <iterator>
 #include <limits>
 #include <string_view>
 #include "Utility/Log.hpp"
 #include "node.h"
 #include "uv.h"
+#include "v8-container.h"
 #include "v8-context.h"
+#include "v8-exception.h"
+#include "v8-function.h"
 #include "v8-initialization.h"
 #include "v8-isolate.h"
 #include "v8-local-handle.h"
 #include "v8-locker.h"
 #include "v8-maybe.h"
+#include "v8-persistent-handle.h"
 #include "v8-primitive.h"
 #include "v8-script.h"
 namespace node
@@ -51,11 +57,43 @@ using namespace node;
 using namespace v8;
 
 constexpr int THREAD_POOL_SIZE = 4;
+
+// Sets the current vgg like VggExec::setEnv, then calls the listener with each event
+constexpr auto DISPATCH_EVENTS_SCRIPT = R"(
+(function (containerKey, envKey, instanceKey, currentEnvName, currentVggName, listenerKey, events) {
+  globalThis[currentEnvName] = envKey;
+  globalThis[currentVggName] = globalThis[containerKey]?.[envKey]?.[instanceKey];
+  const listener = globalThis[containerKey]?.[envKey]?.[listenerKey];
+  if (listener) {
+    for (const event of events) {
+      listener(event);
+    }
+  }
+})
+)";
+
+Local<v8::String> make_v8_string(Isolate* isolate, const std::string& value)
+{
+  return v8::String::NewFromUtf8(
+           isolate,
+           value.data(),
+           NewStringType::kNormal,
+           static_cast<int>(value.size()))
+    .ToLocalChecked();
+}
 } // namespace
 
 namespace VGG
 {
 
+struct NativeExecImpl::Dispatcher
+{
+  Global<Function> function;
+};
+
+NativeExecImpl::NativeExecImpl() = default;
+NativeExecImpl::~NativeExecImpl() = default;
+
 /*
  * NativeExecImpl
  */
@@ -67,29 +105,121 @@ bool NativeExecImpl::schedule_eval(const std::string& code)
     return false;
   }
 
-  NativeEvalTask* task = new NativeEvalTask();
-  task->m_code = code;
-  task->m_exec_impl_ptr = this;
+  NativeEvalTask task;
+  task.m_code = code;
+  task.m_exec_impl_ptr = this;
+  push_task(std::move(task));
+
+  return true;
+}
+
+bool NativeExecImpl::schedule_dispatch(NativeEventTarget target, const std::string& event)
+{
+  if (!check_state())
+  {
+    FAIL("#NativeExecImpl::schedule_dispatch, error state");
+    return false;
+  }
 
   {
     const std::lock_guard<std::mutex> lock(m_tasks_mutex);
-    m_tasks.push(task);
+
+    // batch the events sent in the same run loop tick, the async is sent for the last task already
+    if (!m_tasks.empty())
+    {
+      auto& last = m_tasks.back();
+      if (!last.m_events.empty() && last.m_target == target)
+      {
+        last.m_events.push_back(event);
+        return true;
+      }
+    }
   }
-  uv_async_send(&m_async_task);
+
+  NativeEvalTask task;
+  task.m_exec_impl_ptr = this;
+  task.m_target = std::move(target);
+  task.m_events.push_back(event);
+  push_task(std::move(task));
 
   return true;
 }
 
+void NativeExecImpl::push_task(NativeEvalTask task)
+{
+  task.m_scheduled_time = std::chrono::steady_clock::now();
+  {
+    const std::lock_guard<std::mutex> lock(m_tasks_mutex);
+    m_tasks.push_back(std::move(task));
+    m_stats.depth = m_tasks.size();
+    m_stats.maxDepth = std::max(m_stats.maxDepth, m_stats.depth);
+  }
+  uv_async_send(&m_async_task); // the sends before the wakeup are coalesced by uv
+}
+
+NativeExec::TaskQueueStats NativeExecImpl::task_queue_stats() const
+{
+  const std::lock_guard<std::mutex> lock(m_tasks_mutex);
+  return m_stats;
+}
+
+int NativeExecImpl::dispatch(const NativeEvalTask& task)
+{
+  DEBUG("#NativeExecImpl::dispatch, enter");
+
+  HandleScope handle_scope(m_isolate);
+  auto        context = m_setup->context();
+
+  if (!m_dispatcher)
+  {
+    Local<Script> script;
+    Local<Value>  function;
+    if (
+      !v8::Script::Compile(context, make_v8_string(m_isolate, DISPATCH_EVENTS_SCRIPT))
+         .ToLocal(&script) ||
+      !script->Run(context).ToLocal(&function) || !function->IsFunction())
+    {
+      FAIL("#NativeExecImpl::dispatch, error, compile dispatch function error");
+      return -1;
+    }
+    m_dispatcher = std::make_unique<Dispatcher>();
+    m_dispatcher->function.Reset(m_isolate, function.As<Function>());
+  }
+
+  auto events = Array::New(m_isolate, static_cast<int>(task.m_events.size()));
+  for (std::size_t i = 0; i < task.m_events.size(); ++i)
+  {
+    events->Set(context, static_cast<uint32_t>(i), make_v8_string(m_isolate, task.m_events[i]))
+      .Check();
+  }
+
+  const auto&  target = task.m_target;
+  Local<Value> args[] = { make_v8_string(m_isolate, target.m_container_key),
+                          make_v8_string(m_isolate, target.m_env_key),
+                          make_v8_string(m_isolate, target.m_instance_key),
+                          make_v8_string(m_isolate, target.m_current_env_name),
+                          make_v8_string(m_isolate, target.m_current_vgg_name),
+                          make_v8_string(m_isolate, target.m_listener_key),
+                          events };
+
+  TryCatch try_catch(m_isolate);
+  auto     function = m_dispatcher->function.Get(m_isolate);
+  if (function->Call(context, context->Global(), std::size(args), args).IsEmpty())
+  {
+    WARN("#NativeExecImpl::dispatch, listener throws an exception");
+    return -1;
+  }
+
+  DEBUG("#NativeExecImpl::dispatch, success");
+  return 0;
+}
+
 int NativeExecImpl::eval(std::string_view buffer)
 {
   DEBUG("#NativeExecImpl::eval, enter");
 
-  Locker         locker(m_isolate);
-  Isolate::Scope isolate_scope(m_isolate);
-  HandleScope    handle_scope(m_isolate);
-
-  auto           context = m_setup->context();
-  Context::Scope context_scope(context);
+  HandleScope handle_scope(m_isolate);
+  auto        context = m_setup->context();
 
   auto maybe_local_v8_string = v8::String::NewFromUtf8(m_isolate, buffer.data());
   if (maybe_local_v8_string.IsEmpty())
@@ -249,6 +379,7 @@ int NativeExecImpl::run_node_instance(
       INFO("#exec, node run");
       exit_code = node::SpinEventLoop(env).FromMaybe(1);
 
+      m_dispatcher.reset(); // the handle must be released before the isolate
       deinit_uv_async_task();
     }
 
@@ -318,19 +449,45 @@ void NativeExecImpl::deinit_uv_async_task()
 
 void NativeExecImpl::run_task()
 {
-  while (!m_tasks.empty())
   {
-    auto task = m_tasks.front();
+    const std::lock_guard<std::mutex> lock(m_tasks_mutex);
+    m_running_tasks.swap(m_tasks);
+    m_stats.depth = 0;
+  }
+  if (m_running_tasks.empty())
+  {
+    return;
+  }
+
+  std::chrono::microseconds total_latency{ 0 };
+  std::chrono::microseconds max_latency{ 0 };
+  {
+    // enters the isolate once for the whole batch
+    Locker         locker(m_isolate);
+    Isolate::Scope isolate_scope(m_isolate);
+    HandleScope    handle_scope(m_isolate);
+    Context::Scope context_scope(m_setup->context());
+
+    for (auto& task : m_running_tasks)
     {
-      const std::lock_guard<std::mutex> lock(m_tasks_mutex);
-      m_tasks.pop();
+      const auto latency = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - task.m_scheduled_time);
+      total_latency += latency;
+      max_latency = std::max(max_latency, latency);
+
+      DEBUG("#evalScript, before eval");
+      int ret = task.m_events.empty() ? eval(task.m_code) : dispatch(task);
+      DEBUG("#evalScript, after eval, ret = %d", ret);
+      UNUSED(ret);
     }
-
-    DEBUG("#evalScript, before eval");
-    int ret = eval(task->m_code);
-    DEBUG("#evalScript, after eval, ret = %d", ret);
-    UNUSED(ret);
   }
+
+  const std::lock_guard<std::mutex> lock(m_tasks_mutex);
+  m_stats.taskCount += m_running_tasks.size();
+  m_stats.batchCount += 1;
+  m_stats.totalLatency += total_latency;
+  m_stats.maxLatency = std::max(m_stats.maxLatency, max_latency);
+  m_running_tasks.clear();
 }
 
 } // namespace VGG
\ No newline at end of file
@@ -15,10 +15,12 @@
  */
 #pragma once
 
+#include "NativeExec.hpp"
+
 #include <string_view>
+#include <chrono>
 #include <memory>
 #include <mutex>
-#include <queue>
 #include <string>
 #include <thread>
 #include <vector>
@@ -44,24 +46,54 @@ class Isolate;
 namespace VGG
 {
 
+// The global keys to find the listener and to set the current vgg before calling it
+struct NativeEventTarget
+{
+  std::string m_container_key;
+  std::string m_env_key;
+  std::string m_instance_key;
+  std::string m_current_env_name;
+  std::string m_current_vgg_name;
+  std::string m_listener_key;
+
+  bool operator==(const NativeEventTarget& other) const = default;
+};
+
 struct NativeEvalTask
 {
   std::string     m_code;
   NativeExecImpl* m_exec_impl_ptr = nullptr;
+
+  std::chrono::steady_clock::time_point m_scheduled_time;
+
+  // If there are events, the task calls the listener of the target with them instead of
+  // evaluating the code. The events sent before the task runs are batched into it.
+  NativeEventTarget        m_target;
+  std::vector<std::string> m_events;
 };
 
 class NativeExecImpl
 {
 public:
+  NativeExecImpl();
+  ~NativeExecImpl();
+
   bool schedule_eval(const std::string& code);
+  bool schedule_dispatch(NativeEventTarget target, const std::string& event);
   int  run_node(const int argc, const char** argv, std::shared_ptr<std::thread>& nodeThread);
   void notify_node_thread_to_stop();
   void stop_node();
 
   node::Environment* getNodeEnv();
 
+  NativeExec::TaskQueueStats task_queue_stats() const;
+
 private:
+  // Must be called in the isolate and context scopes entered by run_task
   int eval(const std::string_view buffer);
+  int dispatch(const NativeEvalTask& task);
+
+  void push_task(NativeEvalTask task);
 
   int node_main(const std::vector<std::string>& args);
   int run_node_instance(
@@ -87,13 +119,21 @@ private:
   node::Environment*            m_env = nullptr;
   uv_loop_t*                    m_loop = nullptr;
 
-  std::queue<NativeEvalTask*> m_tasks;
-  std::mutex                  m_tasks_mutex;
+  // The ui thread appends tasks to m_tasks, the node thread swaps the whole batch out with
+  // m_running_tasks on each wakeup. Both keep their capacity, so no allocation per task.
+  std::vector<NativeEvalTask> m_tasks;
+  std::vector<NativeEvalTask> m_running_tasks;
+  NativeExec::TaskQueueStats  m_stats;
+  mutable std::mutex          m_tasks_mutex;
 
   std::mutex m_state_mutex;
   uv_timer_t m_keep_alive_timer;
   uv_async_t m_stop_timer_async;
   uv_async_t m_async_task;
+
+  // The compiled event dispatch function, only accessed on the node thread
+  struct Dispatcher;
+  std::unique_ptr<Dispatcher> m_dispatcher;
 };
 
 } // namespace VGG
\ No newline at end of file
@@ -15,13 +15,13 @@
  */
 #include "Application/Animate.hpp"
 #include "Application/AttrBridge.hpp"
-#include "Utility/VggTimer.hpp"
 #include "Utility/Log.hpp"
 #include "Domain/Layout/LayoutNode.hpp"
 #include "Domain/Model/Element.hpp"
 #include "Layer/Core/PaintNode.hpp"
 #include "Layer/Core/SceneNode.hpp"
 #include "Application/UIView.hpp"
+#include <algorithm>
 #include <unordered_map>
 
 using namespace VGG;
@@ -170,12 +170,7 @@ Animate::~Animate()
 void Animate::stop()
 {
   m_childAnimates.clear();
-
-  if (m_timer)
-  {
-    m_timer->invalidate();
-    m_timer = nullptr;
-  }
+  m_running = false;
 
   if (!m_callbackWhenStop.empty())
   {
@@ -199,7 +194,7 @@ bool Animate::isRunning()
     return m_parent->isRunning();
   }
 
-  return static_cast<bool>(m_timer);
+  return m_running;
 }
 
 bool Animate::isFinished()
@@ -284,24 +279,27 @@ void Animate::start()
     return;
   }
 
-  assert(!m_timer);
-  m_startTime = std::chrono::steady_clock::now();
-  m_lastTriggeredTime = m_startTime;
-
-  m_timer = std::make_shared<Timer>(
-    getInterval().count() / 1000.0,
-    [this]() { this->timerCallback(); },
-    true);
+  assert(!m_running);
+  m_startTime.reset();
+  m_lastTriggeredTime.reset();
+  m_running = true;
 }
 
-void Animate::timerCallback()
+void Animate::advance(steady_clock::time_point now)
 {
-  assert(isRunning());
+  assert(isIndependent() && isRunning());
 
-  if (isIndependent())
+  if (!m_startTime)
   {
-    m_lastTriggeredTime = steady_clock::now();
+    m_startTime = now;
   }
+  m_lastTriggeredTime = std::max(now, *m_startTime);
+  timerCallback();
+}
+
+void Animate::timerCallback()
+{
+  assert(isRunning());
 
   for (auto& child : getChildAnimate())
   {
@@ -346,6 +344,20 @@ bool AnimateManage::hasRunningAnimation() const
   return false;
 }
 
+void AnimateManage::advance(steady_clock::time_point now)
+{
+  // the callbacks might add animations, which start from the next frame
+  const auto animates = m_animates;
+
+  for (const auto& animate : animates)
+  {
+    if (animate->isRunning() && !animate->isFinished())
+    {
+      animate->advance(now);
+    }
+  }
+}
+
 bool AnimateManage::deleteFinishedAnimate()
 {
   auto it = std::remove_if(
@@ -524,7 +536,7 @@ void ReplaceNodeAnimate::changeOrderForMergeTree(
   auto frames = attrBridge->getView()->getSceneNode()->getFrames();
 
   auto cmp = [](const VGG::layer::FramePtr& frame, VGG::layer::PaintNode* node)
-  { return frame->node() == node; };
+  { return frame->isBuilt() && frame->node() == node; };
   auto itFrom = std::find_if(
     frames.begin(),
     frames.end(),
@@ -62,6 +62,7 @@ void AppLayoutContext::didUpdateBounds(LayoutNode* node)
       "AppLayoutContext::didUpdateBounds, no paint node, [%s, %s]",
       node->id().c_str(),
       node->name().c_str());
+    m_needsRebuildScene = true;
     return;
   }
   const auto size = node->bounds().size;
@@ -73,7 +74,8 @@ void AppLayoutContext::didUpdateBounds(LayoutNode* node)
     node->size().width,
     node->size().height);
 
-  m_layerBridge->updateSize(node->shared_from_this(), paintNode, size.width, size.height, true);
+  if (!m_layerBridge->updateSize(node->shared_from_this(), paintNode, size.width, size.height, true))
+    m_needsRebuildScene = true;
   setLayerValid(false);
 }
 
@@ -87,6 +89,7 @@ void AppLayoutContext::didUpdateMatrix(LayoutNode* node)
       "AppLayoutContext::didUpdateMatrix, no paint node, [%s, %s]",
       node->id().c_str(),
       node->name().c_str());
+    m_needsRebuildScene = true;
     return;
   }
 
@@ -96,13 +99,16 @@ void AppLayoutContext::didUpdateMatrix(LayoutNode* node)
     node->name().c_str());
   const auto&   m = node->modelMatrix();
   TDesignMatrix newMatrix{ m.a, m.b, m.c, m.d, m.tx, m.ty };
-  m_layerBridge->updateMatrix(node->shared_from_this(), paintNode, newMatrix, true);
+  if (!m_layerBridge->updateMatrix(node->shared_from_this(), paintNode, newMatrix, true))
+    m_needsRebuildScene = true;
   setLayerValid(false);
 }
 
 void AppLayoutContext::didUpdateContourPoints(LayoutNode* node)
 {
   ASSERT(node);
+  // the layer has no api to patch the contour of a path node
+  m_needsRebuildScene = true;
 }
 
 bool AppLayoutContext::isLayerValid() const
@@ -114,4 +120,13 @@ void AppLayoutContext::setLayerValid(bool valid)
   m_isLayerValid = valid;
 }
 
+bool AppLayoutContext::needsRebuildScene() const
+{
+  return m_needsRebuildScene;
+}
+void AppLayoutContext::setNeedsRebuildScene(bool needs)
+{
+  m_needsRebuildScene = needs;
+}
+
 } // namespace VGG
\ No newline at end of file
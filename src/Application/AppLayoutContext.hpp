@@ -36,9 +36,13 @@ public:
   void didUpdateMatrix(LayoutNode* node) override;
   void didUpdateContourPoints(LayoutNode* node) override;
 
+  bool needsRebuildScene() const override;
+  void setNeedsRebuildScene(bool needs) override;
+
 private:
   std::shared_ptr<AttrBridge> m_layerBridge;
   bool                        m_isLayerValid = false;
+  bool                        m_needsRebuildScene = false;
 };
 
 } // namespace VGG
\ No newline at end of file
@@ -100,6 +100,7 @@ void setLayoutNodePatternAttr(
       }
 
       std::visit(fun, pattern->instance);
+      Domain::Element::markModelChanged();
     }
     else
     {
@@ -420,6 +421,7 @@ void AttrBridge::setFillEnabled(std::shared_ptr<LayoutNode> node, size_t index,
   }
 
   object->style.fills.at(index).isEnabled = enabled;
+  Domain::Element::markModelChanged();
 }
 
 void AttrBridge::setFillEnabled(layer::PaintNode* node, size_t index, bool enabled)
@@ -452,6 +454,7 @@ void AttrBridge::setFillColor(
   color->red = static_cast<float>(argb.at(1));
   color->green = static_cast<float>(argb.at(2));
   color->blue = static_cast<float>(argb.at(3));
+  Domain::Element::markModelChanged();
 }
 
 void AttrBridge::setFillColor(layer::PaintNode* node, size_t index, const std::vector<double>& argb)
@@ -483,6 +486,7 @@ void AttrBridge::setFillOpacity(std::shared_ptr<LayoutNode> node, size_t index,
       return;
     }
     object->style.fills.at(index).contextSettings.opacity = value;
+    Domain::Element::markModelChanged();
   }
 }
 
@@ -509,6 +513,7 @@ void AttrBridge::setFillBlendMode(std::shared_ptr<LayoutNode> node, size_t index
       return;
     }
     object->style.fills.at(index).contextSettings.blendMode = value;
+    Domain::Element::markModelChanged();
   }
 }
 
@@ -687,6 +692,7 @@ void AttrBridge::setOpacity(std::shared_ptr<LayoutNode> node, double value)
   if (auto object = AttrBridge::getlayoutNodeObject(node))
   {
     object->contextSettings.opacity = value;
+    Domain::Element::markModelChanged();
   }
 }
 
@@ -705,6 +711,7 @@ void AttrBridge::setVisible(std::shared_ptr<LayoutNode> node, bool value)
   if (auto object = AttrBridge::getlayoutNodeObject(node))
   {
     object->visible = value;
+    Domain::Element::markModelChanged();
   }
 }
 
@@ -731,6 +738,7 @@ void AttrBridge::setMatrix(std::shared_ptr<LayoutNode> node, const TDesignMatrix
   }
 
   std::copy(designMatrix.begin(), designMatrix.end(), object->matrix.begin());
+  Domain::Element::markModelChanged();
 }
 
 void AttrBridge::setMatrix(layer::PaintNode* node, const TDesignMatrix& designMatrix)
@@ -748,6 +756,7 @@ void AttrBridge::setWidth(std::shared_ptr<LayoutNode> node, const double width)
   }
 
   object->bounds.width = width;
+  Domain::Element::markModelChanged();
 }
 
 void AttrBridge::setWidth(layer::PaintNode* node, const double width)
@@ -769,6 +778,7 @@ void AttrBridge::setHeight(std::shared_ptr<LayoutNode> node, const double height
   }
 
   object->bounds.height = height;
+  Domain::Element::markModelChanged();
 }
 
 void AttrBridge::setHeight(layer::PaintNode* node, const double height)
@@ -840,16 +850,17 @@ layer::PaintNode* AttrBridge::getPaintNode(std::shared_ptr<LayoutNode> node)
 
   const auto& id = element->idNumber();
 
-  // for top-level frame
-  if (node->parent() && !node->parent()->parent())
+  // find the top-level frame of the node, so that only the frame is built if it's not yet
+  auto page = node.get();
+  while (page->parent() && page->parent()->parent())
   {
-    for (auto& frame : sceneNode->getFrames())
+    page = page->parent();
+  }
+  if (auto pageElement = page->parent() ? page->elementNode() : nullptr)
+  {
+    if (auto frame = sceneNode->frameByID(pageElement->idNumber()))
     {
-      ASSERT(frame->node());
-      if (frame->node()->uniqueID() == id)
-      {
-        return frame->node();
-      }
+      return frame->nodeByID(id);
     }
   }
 
@@ -894,6 +905,7 @@ bool AttrBridge::addFill(
     {
       auto& fills = object->style.fills;
       fills.insert(fills.begin() + index, value);
+      Domain::Element::markModelChanged();
     }
   }
 
@@ -961,6 +973,7 @@ bool AttrBridge::delFill(
     {
       auto& fills = object->style.fills;
       fills.erase(fills.begin() + index);
+      Domain::Element::markModelChanged();
     }
   }
 
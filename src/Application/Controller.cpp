@@ -472,6 +472,7 @@ void Controller::observeViewEvent()
     {
       if (auto sharedThis = weakThis.lock())
       {
+        sharedThis->m_editor->setLayoutContext(sharedThis->layoutContext());
         sharedThis->m_editor->handleUIEvent(event, targetNode);
       }
     });
@@ -617,8 +618,18 @@ void Controller::updateDisplayContentIfNeeded()
 {
   if (m_editor->isModelDirty())
   {
-    m_presenter->update();
-    layoutContext()->setLayerValid(false);
+    auto context = layoutContext();
+    currentFrame()->layoutIfNeeded(context);
+    if (context->needsRebuildScene())
+    {
+      m_presenter->update();
+      context->setLayerValid(false);
+    }
+    else
+    {
+      m_presenter->setDirtry(); // every edit has been patched into the scene
+    }
+    context->setNeedsRebuildScene(false);
     m_editor->resetModelDirty();
   }
 }
@@ -471,7 +471,9 @@ void Editor::resizeNode(MouseEvent* mouseMove)
         break;
     }
   }
+  selectedNode->setContext(m_layoutContext);
   selectedNode->setFrame(frame, true);
+  selectedNode->setContext(nullptr);
   m_isModelDirty = true;
 }
 
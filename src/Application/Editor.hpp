@@ -25,6 +25,7 @@
 class SkCanvas;
 namespace VGG
 {
+class LayoutContext;
 class LayoutNode;
 class UIView;
 } // namespace VGG
@@ -73,6 +74,7 @@ private:
   bool m_isModelDirty{ false };
 
   std::weak_ptr<Listener> m_listener;
+  LayoutContext*          m_layoutContext{ nullptr };
 
 public:
   Editor(std::weak_ptr<UIView> contentView, std::shared_ptr<Mouse> mouse)
@@ -102,6 +104,12 @@ public:
     m_listener = listener;
   }
 
+  // The edits are patched into the rendered scene through the context
+  void setLayoutContext(LayoutContext* context)
+  {
+    m_layoutContext = context;
+  }
+
 private:
   void drawBorder(SkCanvas* canvas, const LayoutNode* node);
 
@@ -16,6 +16,7 @@
 
 #include "Pager.hpp"
 #include <cstddef>
+#include <cstdlib>
 #include <vector>
 #include "Layer/Core/FrameNode.hpp"
 #include "Layer/Core/PaintNode.hpp"
@@ -25,6 +26,11 @@
 namespace VGG::internal
 {
 
+namespace
+{
+constexpr std::size_t K_RELEASE_AFTER_PAGE_CHANGES = 16;
+} // namespace
+
 Pager::Pager(layer::SceneNode* sceneNode)
   : m_sceneNode(sceneNode)
 {
@@ -33,10 +39,11 @@ Pager::Pager(layer::SceneNode* sceneNode)
     const auto& frames = m_sceneNode->getFrames();
     for (std::size_t i = 0; i < m_sceneNode->getFrames().size(); i++)
     {
-      frames[i]->node()->setVisible(false);
+      frames[i]->setVisible(false);
     }
     m_currentPage = 0;
-    frames[m_currentPage]->node()->setVisible(true);
+    frames[m_currentPage]->setVisible(true);
+    m_lastShown.assign(frames.size(), 0);
   }
   else
   {
@@ -96,10 +103,47 @@ void Pager::setPageOffset(int delta)
     if (newPage == m_currentPage)
       return;
     const auto& frames = m_sceneNode->getFrames();
-    frames[m_currentPage]->node()->setVisible(false);
-    frames[newPage]->node()->setVisible(true);
+    frames[m_currentPage]->setVisible(false);
+    frames[newPage]->setVisible(true);
     m_currentPage = newPage;
+
+    m_lastShown.resize(frames.size(), m_pageChanges);
+    m_lastShown[m_currentPage] = ++m_pageChanges;
+    releaseStaleFrames();
+  }
+}
+
+void Pager::releaseStaleFrames()
+{
+  const auto& frames = m_sceneNode->getFrames();
+  const int   total = frames.size();
+  for (int i = 0; i < total; i++)
+  {
+    const auto distance = std::abs(i - m_currentPage);
+    if (distance <= 1 || distance == total - 1) // the current frame and its neighbours
+      continue;
+    if (frames[i]->isBuilt() && m_pageChanges - m_lastShown[i] > K_RELEASE_AFTER_PAGE_CHANGES)
+      frames[i]->release();
+  }
+}
+
+bool Pager::warmUp()
+{
+  if (!m_sceneNode || m_sceneNode->getFrames().empty() || m_currentPage < 0)
+    return false;
+
+  const auto& frames = m_sceneNode->getFrames();
+  const int   total = frames.size();
+  for (auto delta : { 0, 1, -1 })
+  {
+    const auto& frame = frames[(m_currentPage + delta + total) % total];
+    if (!frame->isBuilt())
+    {
+      frame->node();
+      return true;
+    }
   }
+  return false;
 }
 
 } // namespace VGG::internal
\ No newline at end of file
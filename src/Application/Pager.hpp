@@ -16,6 +16,10 @@
 #pragma once
 
 #include "Layer/Core/VBounds.hpp"
+
+#include <cstddef>
+#include <vector>
+
 namespace VGG
 {
 namespace layer
@@ -33,7 +37,12 @@ class Pager
 
   int m_currentPage = -1;
 
+  // The paint nodes of frames are built on demand and released if not shown for a long time
+  std::size_t              m_pageChanges = 0;
+  std::vector<std::size_t> m_lastShown; // m_pageChanges when the frame was last the current one
+
   void setPageOffset(int delta);
+  void releaseStaleFrames();
 
 public:
   Pager(layer::SceneNode* sceneNode);
@@ -47,6 +56,9 @@ public:
   void setPage(int index);
   void nextFrame();
   void prevFrame();
+
+  // Builds at most one frame adjacent to the current one, returns false if there is nothing to do
+  bool warmUp();
 };
 
 } // namespace VGG::internal
\ No newline at end of file
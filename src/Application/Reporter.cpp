@@ -14,7 +14,6 @@
  * limitations under the License.
  */
 #include "Reporter.hpp"
-#include <sstream>
 #include <string>
 #include "Domain/Daruma.hpp"
 #include "Domain/DarumaContainer.hpp"
@@ -100,13 +99,6 @@ void Reporter::sendEventToJs(const nlohmann::json& event)
 {
   DEBUG("Reporter::sendEventToJs, event is: %s", event.dump().c_str());
 
-  auto env = m_env.lock();
-  if (!env)
-  {
-    FAIL("#Reporter::sendEventToJs, no env");
-    return;
-  }
-
   auto jsEngine = m_jsEngine.lock();
   if (!jsEngine)
   {
@@ -114,20 +106,5 @@ void Reporter::sendEventToJs(const nlohmann::json& event)
     return;
   }
 
-  std::ostringstream oss;
-  oss << "(function (event) {"
-      << "const containerKey = '" << env->getContainerKey() << "';"
-      << "const envKey = '" << env->getEnv() << "';"
-      << "const listenerKey = '" << env->getListenerKey() << "';"
-      << R"(
-          const listener = globalThis[containerKey]?.[envKey]?.[listenerKey]
-          if(listener) {
-            listener(event);
-          }
-        })
-      )"
-      << "('" << event.dump() << "');";
-  DEBUG("Reporter::sendEventToJs, script is: %s", oss.str().c_str());
-
-  jsEngine->evalModule(oss.str());
+  jsEngine->dispatchEvent(event.dump());
 }
@@ -25,6 +25,7 @@
 #include "Layer/Core/EventManager.hpp"
 #include "Layer/Graphics/GraphicsContext.hpp"
 #include "Layer/VGGLayer.hpp"
+#include "RunLoop.hpp"
 #include "UIScrollView.hpp"
 
 namespace VGG
@@ -101,6 +102,9 @@ bool UIApplication::paint(int fps, bool force)
     m_controller->updateDisplayContentIfNeeded();
     if (m_layer->beginFrame(fps))
     {
+      // All the animations are updated with the timestamp of this frame, then the changed nodes
+      // are revalidated together while rendering.
+      m_view->advanceAnimations();
       m_layer->render();
       m_layer->endFrame();
 
@@ -117,14 +121,49 @@ bool UIApplication::paint(int fps, bool force)
     }
   }
 
+  // The loop keeps running without painting until the frames next to the current one are built
+  if (m_view->isWarmingUp())
+  {
+    m_view->warmUpPages();
+  }
+
   return false;
 }
 
 bool UIApplication::needsPaint()
+{
+  // The placeholders are replaced by the tiles once they are rasterized
+  return isDirty() || m_layer->hasPendingTiles();
+}
+
+bool UIApplication::isDirty()
 {
   return m_view->isDirty() || m_controller->hasDirtyEditor() || layer::EventManager::hasEvents();
 }
 
+std::optional<CappingProfiler::dms> UIApplication::idleTimeout(int fps, const RunLoop& runLoop)
+{
+  // The pending tiles wake the loop up once they are rasterized if the layer supports it
+  std::optional<CappingProfiler::dms> timeout;
+  if (isDirty() || (m_layer->hasPendingTiles() && !m_layer->wakesUpOnRasterized()))
+  {
+    timeout = CappingProfiler::getInstance()->timeToNextFrame(fps);
+  }
+  else if (m_view->isWarmingUp())
+  {
+    timeout = CappingProfiler::dms{ 0 };
+  }
+
+  if (const auto deadline = runLoop.nextDeadline())
+  {
+    CappingProfiler::dms untilDeadline = *deadline - RunLoop::Clock::now();
+    untilDeadline = std::max(untilDeadline, CappingProfiler::dms{ 0 });
+    timeout = timeout ? std::min(*timeout, untilDeadline) : untilDeadline;
+  }
+
+  return timeout;
+}
+
 bool UIApplication::handleKeyEvent(VKeyboardEvent evt)
 {
   auto key = evt.keysym.sym;
@@ -445,18 +445,22 @@ UIView::EventHandleResult UIView::dispatchMouseEventOnPage(
   const Layout::Point pointToPage = converPointFromWindowAndScale(x, y);
   const auto          p = pointToDocument(x, y, pointToPage, *page);
 
-  auto target = page->hitTest(
+  auto target = hitTest(
+    eventContext,
+    *page,
     p,
     [&queryHasEventListener = m_hasEventListener, type](const std::string& targetKey)
     { return queryHasEventListener(targetKey, type); });
   std::shared_ptr<VGG::LayoutNode> hitNodeInTarget;
   if (target.first)
   {
-    hitNodeInTarget = target.first->hitTest(p, nullptr).first;
+    hitNodeInTarget = hitTest(eventContext, *page, p, nullptr, target.first.get()).first;
   }
 
   if (updateCursor && (type == EUIEventType::MOUSEMOVE))
-    page->hitTest(
+    hitTest(
+      eventContext,
+      *page,
       p,
       [&updateCursorEventListener = m_updateCursorEventListener, type](const std::string& targetKey)
       { return updateCursorEventListener(targetKey, type); });
@@ -470,7 +474,9 @@ UIView::EventHandleResult UIView::dispatchMouseEventOnPage(
                                EUIEventType::CONTEXTMENU };
       for (auto clickType : types)
       {
-        auto clickTarget = page->hitTest(
+        auto clickTarget = hitTest(
+          eventContext,
+          *page,
           p,
           [&queryHasEventListener = m_hasEventListener, clickType](const std::string& targetKey)
           { return queryHasEventListener(targetKey, clickType); });
@@ -560,6 +566,28 @@ UIView::EventHandleResult UIView::dispatchMouseEventOnPage(
   return { true, !!target.first };
 }
 
+UIView::TargetNode UIView::hitTest(
+  EventContext&                  eventContext,
+  LayoutNode&                    page,
+  const Layout::Point&           point,
+  const LayoutNode::HitTestHook& hasEventListener,
+  const LayoutNode*              node)
+{
+  if (m_impl->isAnimating()) // the frames are changing in every loop
+  {
+    eventContext.hitTestIndex.invalidate();
+  }
+  return eventContext.hitTestIndex.hitTest(page, point, hasEventListener, node);
+}
+
+void UIView::invalidateHitTestIndexes()
+{
+  for (auto& [id, context] : m_presentedTreeContext)
+  {
+    context.hitTestIndex.invalidate();
+  }
+}
+
 void UIView::handleMouseOut(
   EventContext&                    eventContext,
   TargetNode                       target,
@@ -732,6 +760,7 @@ void UIView::show(
 
   auto result =
     layer::SceneBuilder::builder()
+      .setLazyBuildEnable(true)
       .setFontNameVisitor(
         [requiredFonts](const std::string& familyName, const std::string& subfamilyName)
         {
@@ -786,7 +815,9 @@ bool UIView::handleTouchEvent(int x, int y, int motionX, int motionY, EUIEventTy
   if (!page)
     return false;
 
-  auto [target, key] = page->hitTest(
+  auto [target, key] = hitTest(
+    m_presentedTreeContext[page->id()],
+    *page,
     pointToDocument(x, y, converPointFromWindowAndScale(x, y), *page),
     [&queryHasEventListener = m_hasEventListener, type](const std::string& targetKey)
     { return queryHasEventListener(targetKey, type); });
@@ -899,6 +930,7 @@ void UIView::saveState(const std::shared_ptr<StateTree>& stateTree)
   else
     m_stateTrees.push_back(stateTree);
 
+  invalidateHitTestIndexes(); // the instance node is moved to the state tree
   EventContext& currentContext = m_presentedTreeContext[currentPage()->id()];
   EventContext& oldContext = m_presentedTreeContext[stateTree->id()]; // make context
 
@@ -960,6 +992,7 @@ void UIView::restoreState(const std::string& instanceId)
     DEBUG("UIView::restoreState, restore state tree: %s", (*it)->id().c_str());
     m_presentedTreeContext.erase((*it)->id());
     m_stateTrees.erase(it);
+    invalidateHitTestIndexes();
   }
 }
 
@@ -1023,6 +1056,20 @@ layer::Ref<layer::SceneNode> UIView::getSceneNode()
 void UIView::frame()
 {
   setDirty(m_impl->deleteFinishedAnimation());
+
+  // The paint nodes are built from the model which is only accessed on this thread, so the frames
+  // next to the current one are built here, one per loop after the frame is presented.
+  warmUpPages();
+}
+
+void UIView::warmUpPages()
+{
+  m_isWarmingUp = m_impl->warmUpPages();
+}
+
+void UIView::advanceAnimations()
+{
+  m_impl->advanceAnimations(std::chrono::steady_clock::now());
 }
 
 bool UIView::isDirty()
@@ -15,6 +15,7 @@
  */
 
 #include "UIViewImpl.hpp"
+#include <algorithm>
 #include <chrono>
 #include <functional>
 #include <iterator>
@@ -30,13 +31,14 @@
 #include "Application/ElementUpdateProperty.hpp"
 #include "Application/ViewModel.hpp"
 #include "AttrBridge.hpp"
+#include "Domain/Layout/Layout.hpp"
 #include "Domain/Layout/LayoutNode.hpp"
 #include "Domain/Layout/Rect.hpp"
 #include "Domain/Model/Element.hpp"
 #include "Event/Event.hpp"
 #include "Layer/Core/AttributeAccessor.hpp"
 #include "Layer/Core/Attrs.hpp"
-#include "Layer/Core/MemoryResourceProvider.hpp"
+#include "Layer/Core/LazyResourceProvider.hpp"
 #include "Layer/Core/PaintNode.hpp"
 #include "Layer/Core/ResourceManager.hpp"
 #include "Layer/Core/ResourceProvider.hpp"
@@ -57,6 +59,16 @@ namespace
 {
 constexpr auto K_ANIMATION_INTERVAL = 16;
 
+// Wraps the blob of the model without copying, the SkData keeps it alive
+layer::Blob makeSkData(const Model::BlobPtr& blob)
+{
+  return SkData::MakeWithProc(
+    blob->data(),
+    blob->size(),
+    [](const void*, void* context) { delete static_cast<Model::BlobPtr*>(context); },
+    new Model::BlobPtr(blob));
+}
+
 struct UpdateBuilderVisitor
 {
   UIViewImpl*                   viewImpl = nullptr;
@@ -368,13 +380,33 @@ void UIViewImpl::show(std::shared_ptr<ViewModel>& viewModel, std::vector<layer::
   m_pager = std::make_unique<Pager>(m_sceneNode.get());
   setPageIndex(page());
 
-  const auto&                                        repo = m_viewModel->resources();
-  std::unordered_map<std::string, std::vector<char>> data(
-    std::make_move_iterator(repo.begin()),
-    std::make_move_iterator(repo.end()));
+  // Keeps the decoded images if the scene is rebuilt for the same model
+  const auto sameModel = !m_resourceModel.owner_before(m_viewModel->model) &&
+                         !m_viewModel->model.owner_before(m_resourceModel);
+  if (
+    sameModel && m_resourceProvider &&
+    layer::getGlobalResourceProvider() == static_cast<layer::ResourceProvider*>(m_resourceProvider))
+  {
+    m_resourceProvider->warmUp(m_viewModel->frameResourceNames(page()));
+    return;
+  }
 
-  layer::setGlobalResourceProvider(
-    std::make_unique<layer::MemoryResourceProvider>(std::move(data)));
+  auto provider = std::make_unique<layer::LazyResourceProvider>(
+    [model = m_viewModel->model](std::string_view guid) -> layer::Blob
+    {
+      if (auto sharedModel = model.lock())
+      {
+        if (auto blob = sharedModel->readResource(std::string(guid)))
+        {
+          return makeSkData(blob);
+        }
+      }
+      return nullptr;
+    });
+  provider->warmUp(m_viewModel->frameResourceNames(page()));
+  m_resourceModel = m_viewModel->model;
+  m_resourceProvider = provider.get();
+  layer::setGlobalResourceProvider(std::move(provider));
 }
 
 int UIViewImpl::page() const
@@ -442,6 +474,11 @@ void UIViewImpl::previoustPage()
   m_pager->prevFrame();
 }
 
+bool UIViewImpl::warmUpPages()
+{
+  return m_pager && m_pager->warmUp();
+}
+
 bool UIViewImpl::onEvent(UEvent evt, void* userData)
 {
   if (!m_zoomController)
@@ -509,6 +546,11 @@ bool UIViewImpl::isAnimating()
   return m_animationManager.hasRunningAnimation();
 }
 
+void UIViewImpl::advanceAnimations(std::chrono::steady_clock::time_point now)
+{
+  m_animationManager.advance(now);
+}
+
 bool UIViewImpl::setInstanceState(
   const LayoutNode*             oldNode,
   const LayoutNode*             newNode,
@@ -605,13 +647,35 @@ void UIViewImpl::moveFramesToTopLeft()
     m_animationManager);
   for (auto& frame : frames)
   {
+    auto origin = frame->bounds().origin;
+    auto size = frame->bounds().size;
+
+    // Frames not built yet are moved in the model only, they are built from it later
+    auto frameNode = m_sceneNode->frameByID(frame->elementNode()->idNumber());
+    if (frameNode && !frameNode->isBuilt())
+    {
+      auto object = AttrBridge::getlayoutNodeObject(frame);
+      if (object && object->matrix.size() == 6)
+      {
+        TDesignMatrix matrix;
+        std::copy(object->matrix.begin(), object->matrix.end(), matrix.begin());
+        auto newMatrix = TransformHelper::moveToWindowTopLeft(
+          origin.x,
+          -origin.y,
+          size.width,
+          size.height,
+          matrix);
+        std::copy(newMatrix.begin(), newMatrix.end(), object->matrix.begin());
+        Domain::Element::markModelChanged();
+      }
+      continue;
+    }
+
     auto paintNode = layerBridge->getPaintNode(frame);
     ASSERT(paintNode);
 
     if (auto maybeMatrix = layerBridge->getMatrix(paintNode))
     {
-      auto origin = frame->bounds().origin;
-      auto size = frame->bounds().size;
       auto newMatrix = TransformHelper::moveToWindowTopLeft(
         origin.x,
         -origin.y,
@@ -635,15 +699,15 @@ std::optional<UIViewImpl::UpdateBuilder> UIViewImpl::makeUpdateBuilder(
   const app::UIAnimationOption* option,
   Animate*                      parentAnimation)
 {
-  const auto& root = m_viewModel->layoutTree();
-  if (!root)
-    return std::nullopt;
-
-  auto layoutNode = root->findDescendantNodeById(id);
+  auto layoutNode = findLayoutNode(id);
   if (!layoutNode)
     return std::nullopt;
 
-  auto paintNode = m_sceneNode->nodeByID(layoutNode->elementNode()->idNumber());
+  auto updater = std::make_shared<AttrBridge>(
+    std::static_pointer_cast<UIView>(m_api->shared_from_this()),
+    m_animationManager);
+
+  auto paintNode = updater->getPaintNode(layoutNode->shared_from_this());
   if (!paintNode)
     return std::nullopt;
 
@@ -663,10 +727,6 @@ std::optional<UIViewImpl::UpdateBuilder> UIViewImpl::makeUpdateBuilder(
       timing);
   }
 
-  auto updater = std::make_shared<AttrBridge>(
-    std::static_pointer_cast<UIView>(m_api->shared_from_this()),
-    m_animationManager);
-
   return UpdateBuilder{ updater, layoutNode->shared_from_this(), paintNode, animation };
 }
 
@@ -701,15 +761,12 @@ std::optional<app::ElementProperty> UIViewImpl::getElementProperty(
 
 layer::PaintNode* UIViewImpl::getPaintNode(const std::string& id)
 {
-  const auto& root = m_viewModel->layoutTree();
-  if (!root)
-    return nullptr;
-
-  auto layoutNode = root->findDescendantNodeById(id);
+  auto layoutNode = findLayoutNode(id);
   if (!layoutNode)
     return nullptr;
 
-  return m_sceneNode->nodeByID(layoutNode->elementNode()->idNumber());
+  return AttrBridge(std::static_pointer_cast<UIView>(m_api->shared_from_this()), m_animationManager)
+    .getPaintNode(layoutNode->shared_from_this());
 }
 
 bool UIViewImpl::addElementProperty(const app::ElementAddProperty& command)
@@ -728,23 +785,27 @@ bool UIViewImpl::deleteElementProperty(const app::ElementDeleteProperty& command
 
 std::optional<UIViewImpl::CommandContext> UIViewImpl::makeCommandContext(const std::string& id)
 {
-  const auto& root = m_viewModel->layoutTree();
-  if (!root)
-    return std::nullopt;
-
-  auto layoutNode = root->findDescendantNodeById(id);
+  auto layoutNode = findLayoutNode(id);
   if (!layoutNode)
     return std::nullopt;
 
-  auto paintNode = m_sceneNode->nodeByID(layoutNode->elementNode()->idNumber());
-  if (!paintNode)
-    return std::nullopt;
-
   auto updater = std::make_shared<AttrBridge>(
     std::static_pointer_cast<UIView>(m_api->shared_from_this()),
     m_animationManager);
 
+  auto paintNode = updater->getPaintNode(layoutNode->shared_from_this());
+  if (!paintNode)
+    return std::nullopt;
+
   return CommandContext{ updater, layoutNode->shared_from_this(), paintNode };
 }
 
+LayoutNode* UIViewImpl::findLayoutNode(const std::string& id)
+{
+  // the layout caches the nodes by id, the tree is only scanned on a cache miss
+  if (auto layout = m_viewModel->layout.lock())
+    return layout->findNodeById(id);
+  return nullptr;
+}
+
 } // namespace VGG::internal
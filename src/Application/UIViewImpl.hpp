@@ -39,9 +39,14 @@ union UEvent;
 
 namespace VGG
 {
+class Daruma;
 class LayoutNode;
 class UIView;
 struct ViewModel;
+namespace layer
+{
+class LazyResourceProvider;
+}
 namespace app
 {
 class AppRender;
@@ -82,6 +87,7 @@ public:
     app::AnimationCompletion      completion = app::AnimationCompletion());
   void nextPage();
   void previoustPage();
+  bool warmUpPages();
 
   bool onEvent(UEvent evt, void* userData);
 
@@ -115,6 +121,7 @@ public:
 public:
   bool deleteFinishedAnimation();
   bool isAnimating();
+  void advanceAnimations(std::chrono::steady_clock::time_point now);
 
 public:
   int updateElement(
@@ -143,6 +150,8 @@ private:
 
   void moveFramesToTopLeft();
 
+  LayoutNode* findLayoutNode(const std::string& id);
+
 private:
   UIView* m_api;
 
@@ -152,6 +161,8 @@ private:
   std::unique_ptr<app::ZoomNodeController> m_zoomController;
   layer::Ref<layer::ZoomerNode>            m_zoomer;
   std::shared_ptr<ViewModel>               m_viewModel;
+  std::weak_ptr<Daruma>                    m_resourceModel;
+  layer::LazyResourceProvider*             m_resourceProvider{ nullptr }; // owned globally
 
   AnimateManage m_animationManager;
 
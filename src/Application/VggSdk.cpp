@@ -106,14 +106,13 @@ void VggSdk::setListenerKey(const std::string& listenerKey)
 // design document in vgg daruma file
 std::string VggSdk::designDocument()
 {
-  return getDesignDocument()->content().dump();
+  return getDesignDocument()->contentView().dump();
 }
 
 std::string VggSdk::designDocumentValueAt(const std::string& jsonPointer)
 {
-  const auto&                  docJson = getDesignDocument()->content();
   nlohmann::json::json_pointer path{ jsonPointer };
-  return docJson.at(path).dump();
+  return getDesignDocument()->valueAt(path).dump();
 }
 
 std::string VggSdk::getElement(const std::string& id)
@@ -15,11 +15,71 @@
  */
 #include "ViewModel.hpp"
 #include "Domain/Layout/Layout.hpp"
+#include "Domain/Model/DesignModel.hpp"
 #include "Utility/Log.hpp"
 
+#include <type_traits>
+#include <unordered_set>
+#include <variant>
+
 namespace VGG
 {
 
+namespace
+{
+void collectResourceNames(
+  const Domain::Element&           element,
+  std::unordered_set<std::string>& names)
+{
+  if (auto object = element.object())
+  {
+    if (element.type() == Domain::Element::EType::IMAGE)
+    {
+      names.insert(static_cast<Model::Image*>(object)->imageFileName);
+    }
+    for (const auto& fill : object->style.fills)
+    {
+      if (!fill.pattern)
+      {
+        continue;
+      }
+      std::visit(
+        [&names](const auto& instance)
+        {
+          using T = std::decay_t<decltype(instance)>;
+          if constexpr (requires(const T& t) { t.imageFileName; })
+          {
+            names.insert(instance.imageFileName);
+          }
+        },
+        fill.pattern->instance);
+    }
+  }
+
+  for (const auto& child : element)
+  {
+    if (child)
+    {
+      collectResourceNames(*child, names);
+    }
+  }
+}
+} // namespace
+
+std::vector<std::string> ViewModel::frameResourceNames(std::size_t index) const
+{
+  auto doc = designDoc();
+  if (!doc || index >= doc->childObjects().size())
+  {
+    return {};
+  }
+
+  std::unordered_set<std::string> names;
+  collectResourceNames(*doc->childObjects()[index], names);
+  names.erase({});
+  return { names.begin(), names.end() };
+}
+
 std::shared_ptr<LayoutNode> ViewModel::layoutTree() const
 {
   auto sharedLayout = layout.lock();
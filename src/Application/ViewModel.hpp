@@ -17,6 +17,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 #include "Domain/Daruma.hpp"
 #include "Domain/Loader.hpp"
 #include "Domain/Model/Element.hpp"
@@ -40,17 +41,8 @@ struct ViewModel
   std::shared_ptr<LayoutNode>             layoutTree() const;
   std::shared_ptr<Domain::DesignDocument> designDoc() const;
 
-  VGG::Model::Loader::ResourcesType resources() const
-  {
-    if (auto sharedModel = model.lock())
-    {
-      return sharedModel->resources();
-    }
-    else
-    {
-      return {};
-    }
-  }
+  // Image names referenced by the frame, used to warm up the resources of the current page
+  std::vector<std::string> frameResourceNames(std::size_t index) const;
 };
 
 } // namespace VGG
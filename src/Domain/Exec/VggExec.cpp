@@ -37,6 +37,29 @@ bool VggExec::evalModule(const std::string& code, VGG::EventPtr event)
   return m_jsEngine->evalModule(code, event, m_env);
 }
 
+bool VggExec::dispatchEvent(const std::string& event)
+{
+  if (m_jsEngine->dispatchEvent(event, m_env))
+  {
+    return true;
+  }
+
+  std::ostringstream oss;
+  oss << "(function (event) {"
+      << "const containerKey = '" << m_env->getContainerKey() << "';"
+      << "const envKey = '" << m_env->getEnv() << "';"
+      << "const listenerKey = '" << m_env->getListenerKey() << "';"
+      << R"(
+          const listener = globalThis[containerKey]?.[envKey]?.[listenerKey]
+          if(listener) {
+            listener(event);
+          }
+        })
+      )"
+      << "('" << event << "');";
+  return evalModule(oss.str());
+}
+
 void VggExec::setEnv()
 {
   std::ostringstream oss;
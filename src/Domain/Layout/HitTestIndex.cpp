@@ -0,0 +1,120 @@
+/*
+ * Copyright 2023-2024 VeryGoodGraphics LTD <bd@verygoodgraphics.com>
+ *
+ * Licensed under the VGG License, Version 1.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.verygoodgraphics.com/licenses/LICENSE-1.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "Domain/Layout/HitTestIndex.hpp"
+
+namespace VGG
+{
+
+void HitTestIndex::invalidate()
+{
+  m_root = nullptr;
+  m_entries.clear();
+  m_indexes.clear();
+}
+
+HitTestIndex::Result HitTestIndex::hitTest(
+  LayoutNode&                    root,
+  const Layout::Point&           point,
+  const LayoutNode::HitTestHook& hasEventListener,
+  const LayoutNode*              node)
+{
+  if (!isValid(&root))
+  {
+    build(root);
+  }
+
+  auto it = m_indexes.find(node ? node : &root);
+  if (it == m_indexes.end())
+  {
+    return {};
+  }
+  return hitTest(it->second, point, hasEventListener);
+}
+
+void HitTestIndex::build(LayoutNode& root)
+{
+  invalidate();
+  m_root = &root;
+
+  // Same as LayoutNode::pointInside, the frame of the root is converted to the root of its tree
+  const auto frame = root.frameToAncestor();
+  m_entries.push_back({ root.shared_from_this(), frame, 0 });
+  m_indexes[&root] = 0;
+  const auto& children = root.children();
+  for (auto it = children.rbegin(); it != children.rend(); ++it)
+  {
+    append(*it, &root, frame.origin);
+  }
+  m_entries[0].end = m_entries.size();
+}
+
+void HitTestIndex::append(
+  const std::shared_ptr<LayoutNode>& node,
+  const LayoutNode*                  parent,
+  Layout::Point                      offset)
+{
+  auto frame = node->frame();
+  if (node->parent() == parent)
+  {
+    frame.origin += offset;
+  }
+  else // the state tree is placed by the parent of its source node
+  {
+    frame = node->frameToAncestor();
+  }
+
+  const auto index = m_entries.size();
+  m_entries.push_back({ node, frame, 0 });
+  m_indexes[node.get()] = index;
+  const auto& children = node->children();
+  for (auto it = children.rbegin(); it != children.rend(); ++it)
+  {
+    append(*it, node.get(), frame.origin);
+  }
+  m_entries[index].end = m_entries.size();
+}
+
+HitTestIndex::Result HitTestIndex::hitTest(
+  std::size_t                    index,
+  const Layout::Point&           point,
+  const LayoutNode::HitTestHook& hasEventListener) const
+{
+  const auto& entry = m_entries[index];
+
+  // test front child first
+  for (auto i = index + 1; i < entry.end; i = m_entries[i].end)
+  {
+    if (m_entries[i].frame.contains(point))
+    {
+      if (auto target = hitTest(i, point, hasEventListener); target.first)
+      {
+        return target;
+      }
+    }
+  }
+
+  if (entry.node->shouldHandleEvents() && entry.frame.contains(point))
+  {
+    if (auto key = entry.node->hitTestKey(hasEventListener); key)
+    {
+      return { entry.node, std::move(*key) };
+    }
+  }
+
+  return {};
+}
+
+} // namespace VGG
@@ -43,7 +43,7 @@ Layout::Layout::Layout(JsonDocumentPtr designDoc, JsonDocumentPtr layoutDoc)
   RuleMapPtr rules;
   if (layoutDoc)
   {
-    rules = collectRules(layoutDoc->content());
+    rules = collectRules(layoutDoc->contentView());
   }
 
   new (this) Layout(designDoc, rules);
@@ -362,12 +362,16 @@ LayoutNode* Layout::Layout::findNodeInTreeById(LayoutNode* tree, const std::stri
   if (!tree)
     return nullptr;
 
-  if (m_nodeCacheMap.contains(id)) // cache hit
-    return m_nodeCacheMap[id];
+  if (auto it = m_nodeCacheMap.find(id); it != m_nodeCacheMap.end()) // cache hit
+  {
+    // The ids of the expanded instances are not unique, the cached node must be in the tree
+    if (auto node = it->second.lock(); node && node->id() == id && tree->isAncestorOf(node.get()))
+      return node.get();
+  }
 
   auto p = tree->findDescendantNodeById(id);
   if (p)
-    m_nodeCacheMap[id] = p; // cache result
+    m_nodeCacheMap[id] = p->weak_from_this(); // cache result
 
   return p;
 }
@@ -402,7 +406,7 @@ void Layout::Layout::cacheOneNode(LayoutNode* node)
     return;
 
   if (const auto& id = node->id(); !id.empty())
-    m_nodeCacheMap[id] = node;
+    m_nodeCacheMap[id] = node->weak_from_this();
 }
 
 void Layout::Layout::cacheTreeNodes(LayoutNode* tree)
@@ -411,7 +415,7 @@ void Layout::Layout::cacheTreeNodes(LayoutNode* tree)
     return;
 
   if (const auto& id = tree->id(); !id.empty())
-    m_nodeCacheMap[id] = tree;
+    m_nodeCacheMap[id] = tree->weak_from_this();
 
   for (auto& child : tree->children())
     cacheTreeNodes(child.get());
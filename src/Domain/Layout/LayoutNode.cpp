@@ -86,29 +86,42 @@ std::pair<std::shared_ptr<LayoutNode>, std::string> LayoutNode::hitTest(
 
   if (shouldHandleEvents() && pointInside(point))
   {
-    if (!hasEventListener)
+    if (auto key = hitTestKey(hasEventListener); key)
     {
-      return { shared_from_this(), {} };
+      return { shared_from_this(), std::move(*key) };
     }
+  }
 
-    std::vector<std::string> keys{ id(), originalId(), name() };
-    if (auto ele = elementNode(); ele && (ele->type() == Domain::Element::EType::SYMBOL_INSTANCE))
-    {
-      auto s = static_cast<Domain::SymbolInstanceElement*>(ele);
-      if (!s->shouldKeepListeners())
-        keys.clear();
-      keys.insert(keys.begin(), s->masterId());
-    }
-    for (const auto& key : keys)
+  return {};
+}
+
+std::optional<std::string> LayoutNode::hitTestKey(const HitTestHook& hasEventListener) const
+{
+  if (!shouldHandleEvents())
+  {
+    return std::nullopt;
+  }
+  if (!hasEventListener)
+  {
+    return std::string{};
+  }
+
+  std::vector<std::string> keys{ id(), originalId(), name() };
+  if (auto ele = elementNode(); ele && (ele->type() == Domain::Element::EType::SYMBOL_INSTANCE))
+  {
+    auto s = static_cast<Domain::SymbolInstanceElement*>(ele);
+    if (!s->shouldKeepListeners())
+      keys.clear();
+    keys.insert(keys.begin(), s->masterId());
+  }
+  for (const auto& key : keys)
+  {
+    if (hasEventListener(key))
     {
-      if (hasEventListener(key))
-      {
-        return { shared_from_this(), key };
-      }
+      return key;
     }
   }
-
-  return {};
+  return std::nullopt;
 }
 
 std::shared_ptr<Layout::Internal::AutoLayout> LayoutNode::autoLayout() const
@@ -1421,6 +1434,8 @@ void LayoutNode::scaleContour(
     newModelPoints.push_back(point);
   }
   contourElement.updatePoints(newModelPoints);
+  if (auto c = context())
+    c->didUpdateContourPoints(this);
 }
 
 void LayoutNode::updatePathNodeModel(
@@ -16,11 +16,13 @@
 #pragma once
 
 #include "Loader.hpp"
+#include "MappedBlob.hpp"
 
 #include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <string>
+#include <vector>
 
 namespace fs = std::filesystem;
 
@@ -31,11 +33,21 @@ namespace Model
 
 class DirLoader : public Loader
 {
+public:
+  enum class EReadMode
+  {
+    STREAM,
+    MAP // files are mapped, they must not be modified while the package is loaded
+  };
+
+private:
   std::string m_path;
+  EReadMode   m_mode;
 
 public:
-  DirLoader(const std::string& path)
+  DirLoader(const std::string& path, EReadMode mode = EReadMode::STREAM)
     : m_path{ path }
+    , m_mode{ mode }
   {
   }
 
@@ -43,23 +55,21 @@ public:
   {
     content.clear();
 
-    std::filesystem::path dir{ m_path };
-    std::ifstream         ifs{ dir / name, std::ios::binary };
-    if (!ifs)
+    auto blob = readBlob(name);
+    if (!blob)
     {
       return false;
     }
-    std::istreambuf_iterator<char> start{ ifs }, end;
-    content.append(start, end);
+    content.assign(blob->data(), blob->size());
     return true;
   }
 
-  virtual ResourcesType resources() const override
+  virtual std::vector<std::string> resourceNames() const override
   {
     std::filesystem::path dir{ m_path };
     dir /= K_RESOURCES_DIR_WITH_SLASH;
 
-    ResourcesType resources;
+    std::vector<std::string> names;
 
     if (fs::exists(dir) && fs::is_directory(dir))
     {
@@ -75,16 +85,40 @@ public:
             key.append("/"); // use "/" on both windows & posix
             key.append(it->string());
           }
-
-          std::ifstream                  ifs{ dir_entry.path(), std::ios::binary };
-          std::istreambuf_iterator<char> start{ ifs }, end;
-          std::vector<char>              content{ start, end };
-          resources[key] = std::move(content);
+          names.push_back(std::move(key));
         }
       }
     }
 
-    return resources;
+    return names;
+  }
+
+  virtual BlobPtr readBlob(const std::string& name) const override
+  {
+    std::filesystem::path filePath{ m_path };
+    filePath /= name;
+
+    if (m_mode == EReadMode::MAP)
+    {
+      if (auto blob = MappedBlob::make(filePath))
+      {
+        return blob;
+      }
+    }
+
+    std::ifstream ifs{ filePath, std::ios::binary | std::ios::ate };
+    if (!ifs)
+    {
+      return nullptr;
+    }
+
+    std::vector<char> content(static_cast<std::size_t>(ifs.tellg()));
+    ifs.seekg(0, std::ios::beg);
+    if (!ifs.read(content.data(), content.size()))
+    {
+      return nullptr;
+    }
+    return makeBlob(std::move(content));
   }
 };
 
@@ -0,0 +1,143 @@
+/*
+ * Copyright 2023-2024 VeryGoodGraphics LTD <bd@verygoodgraphics.com>
+ *
+ * Licensed under the VGG License, Version 1.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.verygoodgraphics.com/licenses/LICENSE-1.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "MappedBlob.hpp"
+
+#include "Utility/Log.hpp"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace VGG
+{
+namespace Model
+{
+
+#ifdef _WIN32
+
+BlobPtr MappedBlob::make(const std::filesystem::path& path)
+{
+  HANDLE file = CreateFileW(
+    path.c_str(),
+    GENERIC_READ,
+    FILE_SHARE_READ,
+    nullptr,
+    OPEN_EXISTING,
+    FILE_ATTRIBUTE_NORMAL,
+    nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+  {
+    return nullptr;
+  }
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size))
+  {
+    CloseHandle(file);
+    return nullptr;
+  }
+  if (size.QuadPart == 0)
+  {
+    CloseHandle(file);
+    return makeBlob({});
+  }
+
+  HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  CloseHandle(file);
+  if (!mapping)
+  {
+    return nullptr;
+  }
+
+  auto view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (!view)
+  {
+    CloseHandle(mapping);
+    return nullptr;
+  }
+
+  std::shared_ptr<MappedBlob> blob{ new MappedBlob };
+  blob->m_data = static_cast<const char*>(view);
+  blob->m_size = static_cast<std::size_t>(size.QuadPart);
+  blob->m_mapping = mapping;
+  return blob;
+}
+
+MappedBlob::~MappedBlob()
+{
+  if (m_data)
+  {
+    UnmapViewOfFile(m_data);
+  }
+  if (m_mapping)
+  {
+    CloseHandle(m_mapping);
+  }
+}
+
+#else
+
+BlobPtr MappedBlob::make(const std::filesystem::path& path)
+{
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+  {
+    return nullptr;
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) != 0)
+  {
+    close(fd);
+    return nullptr;
+  }
+  if (st.st_size == 0)
+  {
+    close(fd);
+    return makeBlob({});
+  }
+
+  auto addr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd); // the mapping keeps the file referenced
+  if (addr == MAP_FAILED)
+  {
+    DEBUG("#MappedBlob::make(), mmap failed, %s", path.string().c_str());
+    return nullptr;
+  }
+
+  std::shared_ptr<MappedBlob> blob{ new MappedBlob };
+  blob->m_data = static_cast<const char*>(addr);
+  blob->m_size = static_cast<std::size_t>(st.st_size);
+  return blob;
+}
+
+MappedBlob::~MappedBlob()
+{
+  if (m_data)
+  {
+    munmap(const_cast<char*>(m_data), m_size);
+  }
+}
+
+#endif
+
+} // namespace Model
+} // namespace VGG
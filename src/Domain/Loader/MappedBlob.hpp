@@ -0,0 +1,60 @@
+/*
+ * Copyright 2023-2024 VeryGoodGraphics LTD <bd@verygoodgraphics.com>
+ *
+ * Licensed under the VGG License, Version 1.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.verygoodgraphics.com/licenses/LICENSE-1.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "Domain/Blob.hpp"
+
+#include <cstddef>
+#include <filesystem>
+
+namespace VGG
+{
+namespace Model
+{
+
+// Read-only view of a whole file mapped into memory, the file must not be truncated while mapped.
+class MappedBlob final : public Blob
+{
+  const char* m_data{ nullptr };
+  std::size_t m_size{ 0 };
+#ifdef _WIN32
+  void* m_mapping{ nullptr };
+#endif
+
+public:
+  // Returns nullptr if the file cannot be mapped
+  static BlobPtr make(const std::filesystem::path& path);
+
+  MappedBlob(const MappedBlob&) = delete;
+  MappedBlob& operator=(const MappedBlob&) = delete;
+  ~MappedBlob();
+
+  const char* data() const override
+  {
+    return m_data;
+  }
+
+  std::size_t size() const override
+  {
+    return m_size;
+  }
+
+private:
+  MappedBlob() = default;
+};
+
+} // namespace Model
+} // namespace VGG
@@ -48,6 +48,7 @@ bool ZipLoader::readFile(const std::string& name, std::string& content) const
 {
   content.clear();
 
+  std::lock_guard<std::mutex> lock(m_mutex);
   if (0 == zip_entry_open(m_zipFile, name.c_str()))
   {
     auto size = zip_entry_size(m_zipFile);
@@ -65,38 +66,53 @@ bool ZipLoader::readFile(const std::string& name, std::string& content) const
   return false;
 }
 
-Loader::ResourcesType ZipLoader::resources() const
+std::vector<std::string> ZipLoader::resourceNames() const
 {
-  ResourcesType resources;
+  std::vector<std::string> names;
 
-  int n = zip_entries_total(m_zipFile);
+  std::lock_guard<std::mutex> lock(m_mutex);
+  int                         n = zip_entries_total(m_zipFile);
   for (auto i = 0; i < n; ++i)
   {
-    zip_entry_openbyindex(m_zipFile, i);
+    if (zip_entry_openbyindex(m_zipFile, i) != 0)
     {
-      if (zip_entry_isdir(m_zipFile))
-      {
-        continue;
-      }
+      continue;
+    }
 
+    if (!zip_entry_isdir(m_zipFile))
+    {
       std::string fileName{ zip_entry_name(m_zipFile) };
-      if (fileName.rfind(K_RESOURCES_DIR_WITH_SLASH, 0) == 0)
+      if (fileName.rfind(K_RESOURCES_DIR_WITH_SLASH, 0) == 0 && zip_entry_size(m_zipFile) > 0)
       {
-        auto size = zip_entry_size(m_zipFile);
-        if (size > 0)
-        {
-          std::vector<char> content;
-          content.resize(size);
-          zip_entry_noallocread(m_zipFile, static_cast<void*>(content.data()), size);
-          resources[fileName] = std::move(content);
-        }
-        zip_entry_close(m_zipFile);
+        names.push_back(std::move(fileName));
       }
     }
     zip_entry_close(m_zipFile);
   }
 
-  return resources;
+  return names;
+}
+
+BlobPtr ZipLoader::readBlob(const std::string& name) const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (0 != zip_entry_open(m_zipFile, name.c_str()))
+  {
+    DEBUG("#ZipLoader::readBlob(), read file failed, %s", name.c_str());
+    return nullptr;
+  }
+
+  BlobPtr blob;
+  if (auto size = zip_entry_size(m_zipFile); size > 0)
+  {
+    std::vector<char> content;
+    content.resize(size);
+    zip_entry_noallocread(m_zipFile, static_cast<void*>(content.data()), size);
+    blob = makeBlob(std::move(content));
+  }
+  zip_entry_close(m_zipFile);
+
+  return blob;
 }
 
 } // namespace Model
@@ -17,6 +17,7 @@
 
 #include "Loader.hpp"
 
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -32,13 +33,16 @@ class ZipLoader : public Loader
   std::vector<char> m_zipBuffer;
   zip_t* m_zipFile{ nullptr };
 
+  mutable std::mutex m_mutex; // zip_t keeps the opened entry, one reader at a time
+
 public:
   ZipLoader(const std::string& filePath);
   ZipLoader(std::vector<char>& buffer);
   virtual ~ZipLoader();
 
   virtual bool readFile(const std::string& name, std::string& content) const override;
-  virtual ResourcesType resources() const override;
+  virtual std::vector<std::string> resourceNames() const override;
+  virtual BlobPtr                  readBlob(const std::string& name) const override;
 
 private:
   bool load();
@@ -59,7 +59,7 @@ Daruma::Daruma(const MakeJsonDocFn& makeDesignDocFn, const MakeJsonDocFn& makeLa
 
 Daruma::~Daruma() = default;
 
-bool Daruma::load(const std::string& path)
+bool Daruma::load(const std::string& path, bool mapFiles)
 {
   if (fs::is_regular_file(path))
   {
@@ -67,7 +67,9 @@ bool Daruma::load(const std::string& path)
   }
   else if (fs::is_directory(path))
   {
-    m_loader.reset(new Model::DirLoader(path));
+    m_loader.reset(new Model::DirLoader(
+      path,
+      mapFiles ? Model::DirLoader::EReadMode::MAP : Model::DirLoader::EReadMode::STREAM));
   }
   else
   {
@@ -88,11 +90,11 @@ void Daruma::accept(VGG::Model::Visitor* visitor)
 {
   const std::lock_guard<std::mutex> lock(m_mutex);
 
-  visitor->visit(K_DESIGN_FILE_NAME, m_designDoc->content().dump());
+  visitor->visit(K_DESIGN_FILE_NAME, m_designDoc->contentView().dump());
   visitor->visit(K_EVENT_LISTENERS_FILE_NAME, m_eventListeners.dump());
-  if (m_layoutDoc && m_layoutDoc->content().is_object())
+  if (m_layoutDoc && m_layoutDoc->contentView().is_object())
   {
-    visitor->visit(K_LAYOUT_FILE_NAME, m_layoutDoc->content().dump());
+    visitor->visit(K_LAYOUT_FILE_NAME, m_layoutDoc->contentView().dump());
   }
   if (m_settingsDoc.is_object())
   {
@@ -118,12 +120,14 @@ void Daruma::accept(VGG::Model::Visitor* visitor)
   }
 
   // resouces
-  auto        resouces = m_loader->resources();
   std::string resoucesDir{ Model::K_RESOURCES_DIR_WITH_SLASH };
 
-  for (auto& [name, content] : resouces)
+  for (auto& name : resourceNames())
   {
-    visitor->visit(resoucesDir + name, content);
+    if (auto content = readResource(name))
+    {
+      visitor->visit(resoucesDir + name, *content);
+    }
   }
 }
 
@@ -131,10 +135,13 @@ bool Daruma::loadFiles()
 {
   try
   {
-    std::string fileContent;
-    if (m_loader->readFile(K_DESIGN_FILE_NAME, fileContent))
+    // parse in place, the blob of a mapped directory is not copied
+    auto parse = [](const Model::BlobPtr& blob)
+    { return json::parse(blob->data(), blob->data() + blob->size()); };
+
+    if (auto blob = m_loader->readBlob(K_DESIGN_FILE_NAME))
     {
-      auto tmpJson = json::parse(fileContent);
+      auto tmpJson = parse(blob);
       auto doc = m_makeDesignDocFn(tmpJson);
       m_designDoc = JsonDocumentPtr(new SubjectJsonDocument(doc));
       m_runtimeDesignDoc = m_designDoc;
@@ -145,9 +152,9 @@ bool Daruma::loadFiles()
       return false;
     }
 
-    if (m_loader->readFile(K_LAYOUT_FILE_NAME, fileContent) && m_makeLayoutDocFn)
+    if (auto blob = m_loader->readBlob(K_LAYOUT_FILE_NAME); blob && m_makeLayoutDocFn)
     {
-      auto tmpJson = json::parse(fileContent);
+      auto tmpJson = parse(blob);
       auto doc = m_makeLayoutDocFn(tmpJson);
       m_layoutDoc = JsonDocumentPtr(new SubjectJsonDocument(doc));
       m_runtimeLayoutDoc = m_layoutDoc;
@@ -157,9 +164,9 @@ bool Daruma::loadFiles()
       DEBUG("#Daruma::loadFiles(), read layout file failed");
     }
 
-    if (m_loader->readFile(K_SETTINGS_FILE_NAME, fileContent))
+    if (auto blob = m_loader->readBlob(K_SETTINGS_FILE_NAME))
     {
-      m_settingsDoc = json::parse(fileContent);
+      m_settingsDoc = parse(blob);
       m_impl->setSettings(m_settingsDoc);
     }
     else
@@ -167,17 +174,15 @@ bool Daruma::loadFiles()
       DEBUG("#Daruma::loadFiles(), read settings file failed");
     }
 
-    if (m_loader->readFile(K_EVENT_LISTENERS_FILE_NAME, fileContent))
+    if (auto blob = m_loader->readBlob(K_EVENT_LISTENERS_FILE_NAME))
     {
-      m_eventListeners = json::parse(fileContent);
+      m_eventListeners = parse(blob);
     }
     else
     {
       m_eventListeners = json::object();
     }
 
-    m_resources = m_loader->resources();
-
     return true;
   }
   catch (const std::exception& e)
@@ -187,6 +192,24 @@ bool Daruma::loadFiles()
   }
 }
 
+std::vector<std::string> Daruma::resourceNames() const
+{
+  if (m_loader)
+  {
+    return m_loader->resourceNames();
+  }
+  return {};
+}
+
+Model::BlobPtr Daruma::readResource(const std::string& name) const
+{
+  if (m_loader)
+  {
+    return m_loader->readBlob(name);
+  }
+  return nullptr;
+}
+
 JsonDocumentPtr Daruma::runtimeDesignDoc()
 {
   return m_runtimeDesignDoc;
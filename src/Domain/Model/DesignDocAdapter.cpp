@@ -20,9 +20,46 @@
 #include "Utility/Log.hpp"
 #include <nlohmann/json.hpp>
 
+#include <algorithm>
+#include <cctype>
+#include <optional>
+#include <vector>
+
 namespace VGG::Model
 {
 
+namespace
+{
+
+std::optional<std::size_t> arrayIndex(const std::string& token)
+{
+  if (
+    token.empty() || (token.size() > 1 && token[0] == '0') ||
+    !std::all_of(token.begin(), token.end(), [](unsigned char c) { return std::isdigit(c); }))
+  {
+    return std::nullopt;
+  }
+  return std::stoull(token);
+}
+
+// The children which are serialized into the "childObjects" of the element
+bool hasChildObjects(const Domain::Element& element)
+{
+  switch (element.type())
+  {
+    case Domain::Element::EType::FRAME:
+    case Domain::Element::EType::GROUP:
+    case Domain::Element::EType::SYMBOL_MASTER:
+      return true;
+    case Domain::Element::EType::SYMBOL_INSTANCE:
+      return !element.childObjects().empty();
+    default:
+      return false;
+  }
+}
+
+} // namespace
+
 DesignDocAdapter::DesignDocAdapter(std::shared_ptr<Domain::DesignDocument> designDocTree)
   : m_designDocTree{ designDocTree }
 {
@@ -31,7 +68,66 @@ DesignDocAdapter::DesignDocAdapter(std::shared_ptr<Domain::DesignDocument> desig
 
 json DesignDocAdapter::content() const
 {
-  return m_designDocTree->treeModel();
+  return contentView();
+}
+
+const json& DesignDocAdapter::contentView() const
+{
+  const auto revision = Domain::Element::modelRevision();
+  if (!m_content || m_contentRevision != revision)
+  {
+    m_content = m_designDocTree->treeModel();
+    m_contentRevision = revision;
+  }
+  return *m_content;
+}
+
+json DesignDocAdapter::valueAt(const json::json_pointer& path) const
+{
+  std::vector<std::string> tokens;
+  for (auto p = path; !p.empty(); p.pop_back())
+  {
+    tokens.insert(tokens.begin(), p.back());
+  }
+
+  // Walks down the elements while the path addresses the children, then only the addressed
+  // element is serialized.
+  std::shared_ptr<Domain::Element> element;
+  std::size_t                      i = 0;
+  for (; i + 1 < tokens.size(); i += 2)
+  {
+    const auto index = arrayIndex(tokens[i + 1]);
+    const auto isChildren = element ? (tokens[i] == "childObjects" && hasChildObjects(*element))
+                                    : tokens[i] == "frames";
+    const auto& children = element ? element->childObjects() : m_designDocTree->childObjects();
+    if (!isChildren || !index || *index >= children.size())
+    {
+      break;
+    }
+    if (!element && !std::all_of(
+                      children.begin(),
+                      children.end(),
+                      [](const auto& c) { return c->type() == Domain::Element::EType::FRAME; }))
+    {
+      break; // only the frames are serialized into the document
+    }
+    element = children[*index];
+  }
+
+  if (!element)
+  {
+    return content().at(path);
+  }
+
+  Model::ContainerChildType model;
+  element->getTreeToModel(model, false);
+  json::json_pointer rest;
+  for (; i < tokens.size(); ++i)
+  {
+    rest /= tokens[i];
+  }
+  json value = model;
+  return value.at(rest);
 }
 
 std::string DesignDocAdapter::getElement(const std::string& id)
@@ -52,7 +148,18 @@ void DesignDocAdapter::updateElement(const std::string& id, const std::string& c
     auto        j = element->jsonModel();
     const auto& patch = nlohmann::json ::parse(contentJsonString);
     j.merge_patch(patch);
+
+    const auto oldId = element->id();
+    const auto oldName = element->name();
     element->updateJsonModel(j);
+    if (element->id() != oldId || element->name() != oldName)
+    {
+      Domain::Element::markTreeChanged(); // the key index of the document is stale
+    }
+    else
+    {
+      Domain::Element::markModelChanged();
+    }
   }
 }
 
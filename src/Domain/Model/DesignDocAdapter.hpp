@@ -16,6 +16,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include "JsonDocument.hpp"
 #include <nlohmann/json.hpp>
@@ -34,10 +35,16 @@ class DesignDocAdapter : public JsonDocument
 {
   std::shared_ptr<VGG::Domain::DesignDocument> m_designDocTree;
 
+  // The content built from the tree, it's valid until any element is changed
+  mutable std::optional<json> m_content;
+  mutable unsigned            m_contentRevision{ 0 };
+
 public:
   DesignDocAdapter(std::shared_ptr<VGG::Domain::DesignDocument> designDocTree);
 
   json        content() const override;
+  const json& contentView() const override;
+  json        valueAt(const json::json_pointer& path) const override;
   std::string getElement(const std::string& id) override;
   void        updateElement(const std::string& id, const std::string& contentJsonString) override;
 
@@ -16,6 +16,7 @@
 
 #include "Domain/Model/Element.hpp"
 #include <algorithm>
+#include <atomic>
 #include <optional>
 #include <variant>
 #include "Domain/Model/DesignModel.hpp"
@@ -150,11 +151,16 @@ Model::DesignModel DesignDocument::treeModel(bool reverseChildrenIfFirstOnTop) c
 
 std::shared_ptr<Element> DesignDocument::getElementByKey(const std::string& key)
 {
-  // design document has no object, so we need to find in its children
-  for (auto& child : children())
+  if (m_keyIndexRevision != treeRevision())
   {
-    if (auto element = child->getElementByKey(key))
+    buildKeyIndex();
+  }
+
+  if (auto it = m_keyIndex.find(key); it != m_keyIndex.end())
+  {
+    if (auto element = it->second.lock())
     {
+      ASSERT(element->id() == key || element->name() == key);
       return element;
     }
   }
@@ -162,6 +168,38 @@ std::shared_ptr<Element> DesignDocument::getElementByKey(const std::string& key)
   return nullptr;
 }
 
+void DesignDocument::buildKeyIndex()
+{
+  m_keyIndex.clear();
+  // design document has no object, so the index starts from its children
+  for (auto& child : childObjects())
+  {
+    buildKeyIndex(child);
+  }
+  m_keyIndexRevision = treeRevision();
+}
+
+void DesignDocument::buildKeyIndex(const std::shared_ptr<Element>& element)
+{
+  // Same order as Element::getElementByKey, the first element which has the key wins
+  auto pModel = element->object();
+  if (!pModel)
+  {
+    return;
+  }
+
+  m_keyIndex.try_emplace(pModel->id, element);
+  if (pModel->name)
+  {
+    m_keyIndex.try_emplace(*pModel->name, element);
+  }
+
+  for (auto& child : element->childObjects())
+  {
+    buildKeyIndex(child);
+  }
+}
+
 // Element
 int Element::generateId()
 {
@@ -169,6 +207,33 @@ int Element::generateId()
   return ++s_id;
 }
 
+namespace
+{
+std::atomic<unsigned> g_treeRevision{ 0 };
+std::atomic<unsigned> g_modelRevision{ 0 };
+} // namespace
+
+unsigned Element::treeRevision()
+{
+  return g_treeRevision.load(std::memory_order_relaxed);
+}
+
+void Element::markTreeChanged()
+{
+  g_treeRevision.fetch_add(1, std::memory_order_relaxed);
+  markModelChanged();
+}
+
+unsigned Element::modelRevision()
+{
+  return g_modelRevision.load(std::memory_order_relaxed);
+}
+
+void Element::markModelChanged()
+{
+  g_modelRevision.fetch_add(1, std::memory_order_relaxed);
+}
+
 std::shared_ptr<Element> Element::cloneTree() const
 {
   auto n = clone();
@@ -212,6 +277,7 @@ void Element::setVisible(bool visible)
     return;
   }
   model->visible = visible;
+  markModelChanged();
 }
 
 std::string Element::typeString() const
@@ -271,6 +337,7 @@ void Element::updateBounds(double w, double h)
   {
     model->bounds.width = w;
     model->bounds.height = h;
+    markModelChanged();
   }
 }
 void Element::updateMatrix(double tx, double ty)
@@ -281,6 +348,7 @@ void Element::updateMatrix(double tx, double ty)
     ASSERT(model->matrix.size() == 6);
     model->matrix[4] = tx;
     model->matrix[5] = ty;
+    markModelChanged();
   }
 }
 
@@ -290,6 +358,7 @@ void Element::updateMatrix(const std::vector<double>& matrix)
   {
     ASSERT(model->matrix.size() == matrix.size());
     model->matrix = matrix;
+    markModelChanged();
   }
 }
 
@@ -313,6 +382,7 @@ void Element::addKeyPrefix(const std::string& prefix)
   }
 
   model->id = prefix + model->id;
+  markTreeChanged();
   if (model->overrideKey)
   {
     model->overrideKey = prefix + model->overrideKey.value();
@@ -326,6 +396,7 @@ void Element::makeMaskIdUnique(Domain::SymbolInstanceElement& instance, const st
   {
     return;
   }
+  markModelChanged();
 
   for (auto& item : model->alphaMaskBy)
   {
@@ -359,6 +430,7 @@ void Element::update(const Model::ReferencedStyle& refStyle)
     return;
   }
 
+  markModelChanged();
   model->style = refStyle.style;
   if (refStyle.contextSettings)
   {
@@ -385,6 +457,7 @@ void Element::applyOverride(
   nlohmann::json contentJson = jsonModel();
   applyOverrides(contentJson, name, value, outDirtyNodeIds);
   updateJsonModel(contentJson);
+  markTreeChanged(); // the name might be overridden
 
   if (recursively)
   {
@@ -577,7 +650,7 @@ std::shared_ptr<Element> Element::getElementByKey(const std::string& key)
       return shared_from_this();
     }
 
-    for (auto& child : children())
+    for (auto& child : childObjects())
     {
       if (auto element = child->getElementByKey(key))
       {
@@ -843,6 +916,7 @@ void SymbolInstanceElement::setMaster(const Model::SymbolMaster& master)
 
   object()->style = m_master->style;
   object()->variableDefs = m_master->variableDefs;
+  markModelChanged();
 }
 
 std::vector<std::shared_ptr<Element>> SymbolInstanceElement::updateMasterId(
@@ -893,6 +967,7 @@ void SymbolInstanceElement::updateVariableAssignments(const nlohmann::json& json
 
   std::vector<VariableAssign> newAssignments = json;
   model->variableAssignments = newAssignments;
+  markModelChanged();
 }
 void SymbolInstanceElement::updateBounds(const VGG::Layout::Rect& bounds)
 {
@@ -906,6 +981,7 @@ void SymbolInstanceElement::updateBounds(const VGG::Layout::Rect& bounds)
   model->bounds.y = bounds.origin.y;
   model->bounds.width = bounds.size.width;
   model->bounds.height = bounds.size.height;
+  markModelChanged();
 }
 nlohmann::json SymbolInstanceElement::jsonModel()
 {
@@ -1012,6 +1088,7 @@ void TextElement::updateFields(const nlohmann::json& json)
   }
   Model::Text text = jsonModel;
   m_text = std::make_shared<Model::Text>(text);
+  markModelChanged();
 }
 void TextElement::update(const Model::ReferencedStyle& refStyle)
 {
@@ -1214,6 +1291,7 @@ void ContourElement::updateModel(const Model::SubGeometryType& subGeometry)
   if (auto p = std::get_if<Model::Contour>(&subGeometry))
   {
     *m_contour = *p;
+    markModelChanged();
   }
 }
 void ContourElement::updatePoints(const std::vector<Layout::BezierPoint>& points)
@@ -1223,6 +1301,7 @@ void ContourElement::updatePoints(const std::vector<Layout::BezierPoint>& points
     return;
   }
   ASSERT(m_contour->points.size() == points.size());
+  markModelChanged();
   for (std::size_t i = 0; i < m_contour->points.size(); i++)
   {
     m_contour->points[i].point[0] = points[i].point.x;
@@ -1261,6 +1340,7 @@ void EllipseElement::updateModel(const Model::SubGeometryType& subGeometry)
   if (auto p = std::get_if<Model::Ellipse>(&subGeometry))
   {
     *m_ellipse = *p;
+    markModelChanged();
   }
 }
 
@@ -1285,6 +1365,7 @@ void PolygonElement::updateModel(const Model::SubGeometryType& subGeometry)
   if (auto p = std::get_if<Model::Polygon>(&subGeometry))
   {
     *m_polygon = *p;
+    markModelChanged();
   }
 }
 
@@ -1309,6 +1390,7 @@ void RectangleElement::updateModel(const Model::SubGeometryType& subGeometry)
   if (auto p = std::get_if<Model::Rectangle>(&subGeometry))
   {
     *m_rectangle = *p;
+    markModelChanged();
   }
 }
 
@@ -1333,6 +1415,7 @@ void StarElement::updateModel(const Model::SubGeometryType& subGeometry)
   if (auto p = std::get_if<Model::Star>(&subGeometry))
   {
     *m_star = *p;
+    markModelChanged();
   }
 }
 
@@ -1357,6 +1440,7 @@ void VectorNetworkElement::updateModel(const Model::SubGeometryType& subGeometry
   if (auto p = std::get_if<Model::VectorNetwork>(&subGeometry))
   {
     *m_vectorNetwork = *p;
+    markModelChanged();
   }
 }
 
@@ -20,6 +20,18 @@ nlohmann::json JsonDocument::content() const
 {
   return m_jsonDoc->content();
 }
+const nlohmann::json& JsonDocument::contentView() const
+{
+  return m_jsonDoc->contentView();
+}
+nlohmann::json JsonDocument::valueAt(const json::json_pointer& path) const
+{
+  if (m_jsonDoc)
+  {
+    return m_jsonDoc->valueAt(path);
+  }
+  return content().at(path);
+}
 void JsonDocument::setContent(const json& document)
 {
   m_jsonDoc->setContent(document);
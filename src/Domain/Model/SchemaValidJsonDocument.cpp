@@ -58,10 +58,9 @@ void SchemaValidJsonDocument::replaceAt(const json::json_pointer& path, const js
 
 void SchemaValidJsonDocument::deleteAt(const json::json_pointer& path)
 {
-  auto stub_value = content();
   editTemplate(
     path,
-    stub_value,
+    json{}, // unused
     [](json& tmp_document, json::json_pointer& relative_path, const json& cb_value)
     { JsonDocument::erase(tmp_document, relative_path); },
     [](JsonDocumentPtr& cb_doc, const json::json_pointer& cb_path, const json& cb_value)
@@ -75,7 +74,8 @@ void SchemaValidJsonDocument::editTemplate(
   std::function<void(JsonDocumentPtr&, const json::json_pointer&, const json&)> editFn)
 {
   auto ancestor_path = getNearestHavingClassAncestorPath(path);
-  auto tmp_document = content()[ancestor_path];
+  // only the ancestor is copied and validated
+  auto tmp_document = contentView()[ancestor_path];
 
   json::json_pointer relative_path;
   calculateRelativePath(ancestor_path, path, relative_path);
@@ -115,7 +115,7 @@ bool SchemaValidJsonDocument::validateDocument(const json& document)
 const json::json_pointer SchemaValidJsonDocument::getNearestHavingClassAncestorPath(
   const json::json_pointer& editPath) const
 {
-  const auto& document = content();
+  const auto& document = contentView();
   try
   {
     auto ancestor_path = editPath.parent_pointer();
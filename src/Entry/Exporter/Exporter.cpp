@@ -33,6 +33,7 @@
 #include "Layer/Model/StructModel.hpp"
 #include "Layer/Exporter/SVGExporter.hpp"
 #include "Layer/Exporter/PDFExporter.hpp"
+#include "Layer/ThreadPoolRasterExecutor.hpp"
 
 #include "VGG/Exporter/ImageExporter.hpp"
 #include "VGG/Exporter/SVGExporter.hpp"
@@ -47,6 +48,10 @@
 #include <VGGVersion_generated.h>
 
 #include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
 #include <iostream>
 #include <algorithm>
 #include <iterator>
@@ -55,6 +60,7 @@
 #include <memory>
 #include <optional>
 #include <fstream>
+#include <mutex>
 #include <string>
 #include <sstream>
 #include <thread>
@@ -149,16 +155,23 @@ class Exporter__pImpl
 {
   Exporter* q_api; // NOLINT
 public:
+  const EBackend                     backend;
   std::shared_ptr<VkGraphicsContext> ctx;
   sk_sp<GrRecordingContext>          grRecordingContext;
   SurfaceCreateProc                  proc;
 
-  sk_sp<SkSurface> surface;
+  sk_sp<SkSurface>      surface;
+  std::vector<uint32_t> pixels; // backing store of the raster surface, reused across frames
 
   OutputCallback outputCallback;
-  Exporter__pImpl(Exporter* api)
+  Exporter__pImpl(Exporter* api, EBackend backend)
     : q_api(api)
+    , backend(backend)
   {
+    if (backend == EBackend::RASTER)
+    {
+      return;
+    }
     layer::ContextConfig cfg;
     ctx = std::make_shared<VkGraphicsContext>();
     cfg.stencilBit = 8;
@@ -172,6 +185,22 @@ public:
 
   void resize(int w, int h)
   {
+    if (backend == EBackend::RASTER)
+    {
+      if (!surface || (w != surface->width() || h != surface->height()))
+      {
+        // the surface only wraps the pixels, which grow to the largest frame
+        const auto info = SkImageInfo::MakeN32Premul(w, h);
+        const auto bytes = info.computeMinByteSize();
+        if (pixels.size() * sizeof(uint32_t) < bytes)
+        {
+          pixels.resize((bytes + sizeof(uint32_t) - 1) / sizeof(uint32_t));
+        }
+        surface = SkSurfaces::WrapPixels(info, pixels.data(), info.minRowBytes());
+        ASSERT(surface);
+      }
+      return;
+    }
     ASSERT(ctx);
     if (!surface || (w != surface->width() || h != surface->height()))
     {
@@ -186,6 +215,10 @@ public:
     const layer::ImageOptions&   opts,
     IteratorResult::TimeCost&    cost)
   {
+    if (backend == EBackend::RASTER)
+    {
+      resize(opts.extend[0], opts.extend[1]);
+    }
     {
       layer::ScopedTimer t([&](auto d) { cost.render = d.s(); });
       auto               canvas = surface->getCanvas();
@@ -216,8 +249,8 @@ void setGlobalConfig(const std::string& fileName)
   Config::readGlobalConfig(fileName);
 }
 
-Exporter::Exporter()
-  : d_impl(new Exporter__pImpl(this))
+Exporter::Exporter(EBackend backend)
+  : d_impl(new Exporter__pImpl(this, backend))
 {
 }
 
@@ -225,7 +258,7 @@ void Exporter::info(ExporterInfo* info)
 {
   if (info)
   {
-    info->graphicsInfo = d_impl->ctx->vulkanInfo();
+    info->graphicsInfo = d_impl->ctx ? d_impl->ctx->vulkanInfo() : "raster";
 #ifdef GIT_COMMIT
     info->buildCommit = GIT_COMMIT;
 #else
@@ -241,6 +274,33 @@ void Exporter::setOutputCallback(OutputCallback callback)
   d_impl->outputCallback = std::move(callback);
 }
 
+int Exporter::exportImages(
+  nlohmann::json      design,
+  nlohmann::json      layout,
+  const ImageOption&  imageOpt,
+  const ExportOption& exporterOpt,
+  BuilderResult&      result)
+{
+  auto iter = render(std::move(design), std::move(layout), imageOpt, exporterOpt, result);
+  if (imageOpt.threadCount > 0)
+  {
+    return iter.d_impl->drain(imageOpt.type, imageOpt.imageQuality, d_impl->outputCallback);
+  }
+
+  int               count = 0;
+  std::string       key;
+  std::vector<char> image;
+  while (iter.next(key, image))
+  {
+    ++count;
+    if (d_impl->outputCallback && !d_impl->outputCallback(key, image))
+    {
+      break;
+    }
+  }
+  return count;
+}
+
 class IteratorImplBase
 {
 public:
@@ -249,6 +309,10 @@ public:
   std::vector<layer::FramePtr>           frames; // FIXME:: use const
   std::vector<layer::FramePtr>::iterator iter;
 
+  // The frames are built on demand from the document and released once exported, so only the
+  // paint nodes of the frames being exported are alive.
+  std::shared_ptr<VGG::Domain::DesignDocument> doc;
+
   void initInternal(
     nlohmann::json      json,
     nlohmann::json      layout,
@@ -260,6 +324,7 @@ public:
                  .setLayout(std::move(layout))
                  .setExpandEnabled(exportOpt.enableExpand)
                  .setLayoutEnabled(exportOpt.enableLayout)
+                 .setSnapshotDir(exportOpt.snapshotDir)
                  .build();
     BuilderResult::TimeCost cost;
     cost.layout = res.timeCost.layout.s();
@@ -275,6 +340,7 @@ public:
     }
     auto sceneBuilderResult = VGG::layer::SceneBuilder::builder()
                                 .setResetOriginEnable(true)
+                                .setLazyBuildEnable(true)
                                 .setCheckVersion(VGG_PARSE_FORMAT_VER_STR)
                                 .setAllocator(layer::getGlobalMemoryAllocator())
                                 .build<layer::StructModelFrame>(std::move(frames));
@@ -296,6 +362,7 @@ public:
       }
       iter = this->frames.begin();
     }
+    doc = res.doc;
     result.timeCost = cost;
     index = 0;
   }
@@ -314,46 +381,65 @@ public:
 class ImageIteratorImpl : public IteratorImplBase
 {
 public:
+  struct EncodedImage
+  {
+    std::string                      key;
+    std::optional<std::vector<char>> image;
+    IteratorResult::TimeCost         cost;
+  };
+  using Done = std::function<void(EncodedImage)>;
+
   Exporter&               exporter;
   ImageOption::SizePolicy size;
+
+  // Workers rasterizing and encoding the recorded frames, only used if threadCount > 0
+  std::unique_ptr<layer::ThreadPoolRasterExecutor> pool;
+  std::deque<std::future<EncodedImage>>            pending; // in frame order
+
   ImageIteratorImpl(
     Exporter&               exporter,
     nlohmann::json          json,
     nlohmann::json          layout,
     ImageOption::SizePolicy size,
+    int                     threadCount,
     const ExportOption&     opt,
     BuilderResult&          result)
     : IteratorImplBase(std::move(json), std::move(layout), opt, result)
     , exporter(exporter)
     , size(size)
   {
-    exporter.d_impl->resize(MAX_WIDTH, MAX_HEIGHT);
+    if (threadCount > 0)
+    {
+      pool = std::make_unique<layer::ThreadPoolRasterExecutor>(threadCount);
+    }
+    else if (exporter.d_impl->backend == EBackend::VULKAN)
+    {
+      exporter.d_impl->resize(MAX_WIDTH, MAX_HEIGHT);
+    }
   }
 
-  bool next(
-    std::string&              key,
-    std::vector<char>&        image,
-    EImageType                type,
-    int                       quality,
-    IteratorResult::TimeCost& cost)
+  ~ImageIteratorImpl()
   {
-    if (iter == frames.end())
+    for (auto& f : pending)
     {
-      return false;
+      f.wait(); // the tasks refer to the pictures only, but the workers must be idle
     }
-    auto f = *iter;
-    if (!f)
-      return false;
+  }
+
+  layer::ImageOptions imageOptions(
+    const layer::FramePtr& f,
+    EImageType             type,
+    int                    quality,
+    float&                 scale)
+  {
     f->revalidate();
     const auto b = f->bounds();
-    const auto id = f->guid();
     const auto w = b.size().x;
     const auto h = b.size().y;
 
-    auto          state = exporter.d_impl.get();
     float         actualSize[2];
-    float         scale = 1.0;
     constexpr int MAX_SIDE = std::min(MAX_WIDTH, MAX_HEIGHT);
+    scale = 1.0;
     std::visit(
       layer::Overloaded{ [&](const ImageOption::ScaleDetermine& s)
                          {
@@ -402,7 +488,104 @@ public:
       opts.extend[1],
       actualSize[1]);
     opts.quality = quality;
-    auto res = state->render(f, scale, opts, cost);
+    return opts;
+  }
+
+  // Records the next frame on the calling thread, then it's rasterized and encoded by the pool
+  // while the following frames are recorded. Returns false if there is no more frame.
+  bool submit(EImageType type, int quality, Done done)
+  {
+    ASSERT(pool);
+    if (iter == frames.end() || !*iter)
+    {
+      return false;
+    }
+    auto  f = *iter;
+    float scale;
+    auto  opts = imageOptions(f, type, quality, scale);
+
+    EncodedImage     res;
+    sk_sp<SkPicture> picture;
+    {
+      layer::ScopedTimer t([&](auto d) { res.cost.render = d.s(); });
+      picture = layer::exporter::makePicture(f.get());
+    }
+    res.key = f->guid();
+    f->release();
+    ++iter;
+
+    pool->add(
+      [res = std::move(res), picture = std::move(picture), opts, scale, done]() mutable
+      {
+        {
+          layer::ScopedTimer t([&](auto d) { res.cost.encode = d.s(); });
+          res.image = layer::exporter::makeImage(opts, picture.get(), scale);
+        }
+        done(std::move(res));
+      });
+    return true;
+  }
+
+  bool nextParallel(
+    std::string&              key,
+    std::vector<char>&        image,
+    EImageType                type,
+    int                       quality,
+    IteratorResult::TimeCost& cost)
+  {
+    // keeps every worker busy, the images are returned in frame order
+    while ((int)pending.size() < pool->threadCount() + 1)
+    {
+      auto promise = std::make_shared<std::promise<EncodedImage>>();
+      auto future = promise->get_future();
+      auto done = [promise](EncodedImage res) { promise->set_value(std::move(res)); };
+      if (!submit(type, quality, std::move(done)))
+      {
+        break;
+      }
+      pending.push_back(std::move(future));
+    }
+    if (pending.empty())
+    {
+      return false;
+    }
+    auto res = pending.front().get();
+    pending.pop_front();
+    cost = res.cost;
+    if (!res.image.has_value())
+    {
+      return false;
+    }
+    key = std::move(res.key);
+    image = std::move(res.image.value());
+    return true;
+  }
+
+  bool next(
+    std::string&              key,
+    std::vector<char>&        image,
+    EImageType                type,
+    int                       quality,
+    IteratorResult::TimeCost& cost)
+  {
+    if (pool)
+    {
+      return nextParallel(key, image, type, quality, cost);
+    }
+    if (iter == frames.end())
+    {
+      return false;
+    }
+    auto f = *iter;
+    if (!f)
+      return false;
+    const auto id = f->guid();
+
+    auto  state = exporter.d_impl.get();
+    float scale;
+    auto  opts = imageOptions(f, type, quality, scale);
+    auto  res = state->render(f, scale, opts, cost);
+    f->release();
     if (!res.has_value())
     {
       return false;
@@ -412,6 +595,54 @@ public:
     ++iter;
     return true;
   }
+
+  // Delivers the images in completion order, stops submitting frames once the callback returns
+  // false. Returns the number of delivered images.
+  int drain(EImageType type, int quality, const OutputCallback& output)
+  {
+    ASSERT(pool);
+    std::mutex               mutex;
+    std::condition_variable  cond;
+    std::deque<EncodedImage> done;
+    auto                     onDone = [&](EncodedImage res)
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      done.push_back(std::move(res));
+      cond.notify_one();
+    };
+
+    int  inflight = 0;
+    int  count = 0;
+    bool stop = false;
+    while (true)
+    {
+      while (!stop && inflight < pool->threadCount() + 1 && submit(type, quality, onDone))
+      {
+        ++inflight;
+      }
+      if (inflight == 0)
+      {
+        break;
+      }
+      EncodedImage res;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        cond.wait(lock, [&] { return !done.empty(); });
+        res = std::move(done.front());
+        done.pop_front();
+      }
+      --inflight;
+      if (res.image.has_value())
+      {
+        ++count;
+        if (output && !output(res.key, res.image.value()))
+        {
+          stop = true;
+        }
+      }
+    }
+    return count;
+  }
 };
 
 // ImageIterator
@@ -450,6 +681,7 @@ ImageIterator::ImageIterator(
       std::move(design),
       std::move(layout),
       opt.size,
+      opt.threadCount,
       exportOpt,
       result))
   , m_opts(opt)
@@ -488,6 +720,7 @@ bool SVGIterator::next(std::string& key, std::vector<char>& data)
   opts.extend[0] = b.width();
   opts.extend[1] = b.height();
   auto res = layer::exporter::makeSVG(f, opts);
+  f->release();
   if (!res.has_value())
   {
     return false;
@@ -544,6 +777,7 @@ bool PDFIterator::next(std::string& key, std::vector<char>& data)
   opts.extend[0] = b.width();
   opts.extend[1] = b.height();
   auto res = layer::exporter::makePDF(f, opts);
+  f->release();
   if (!res.has_value())
   {
     return false;
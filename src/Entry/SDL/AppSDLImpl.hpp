@@ -20,6 +20,7 @@
 #include "Application/AppBase.hpp"
 #include "Application/Event/EventAPI.hpp"
 #include "EventConvert.hpp"
+#include "Utility/CappingProfiler.hpp"
 #include "Utility/Log.hpp"
 
 #include "Layer/Graphics/GraphicsContext.hpp"
@@ -30,6 +31,7 @@
 #include <SDL_video.h>
 
 #include <any>
+#include <cmath>
 #include <optional>
 
 namespace VGG::entry
@@ -46,6 +48,7 @@ class AppSDLImpl : public AppBase<AppSDLImpl>
   };
   SDLState m_sdlState;
   ContextInfoGL m_glContext;
+  Uint32 m_wakeUpEvent{ (Uint32)-1 };
   using Getter = std::function<std::any(void)>;
   using Setter = std::function<void(std::any)>;
   std::unordered_map<std::string, std::pair<Getter, Setter>> m_properties;
@@ -103,6 +106,7 @@ public:
       return false;
 
     SDL_GL_SetSwapInterval(0);
+    m_wakeUpEvent = SDL_RegisterEvents(1);
 
     // Reigster SDL event impl
     auto eventAPIImpl = std::make_unique<EventAPISDLImpl>();
@@ -268,6 +272,52 @@ public:
     }
   }
 
+  // Blocks until an event arrives or the timeout expires, forever if there is no timeout, then
+  // dispatches all the pending events.
+  void waitEvent(std::optional<CappingProfiler::dms> timeout)
+  {
+    const auto start = CappingProfiler::clock::now();
+
+    SDL_Event evt;
+    int       hasEvent = 0;
+    if (!timeout)
+    {
+      hasEvent = SDL_WaitEvent(&evt);
+    }
+    else if (timeout->count() > 0)
+    {
+      hasEvent = SDL_WaitEventTimeout(&evt, static_cast<int>(std::ceil(timeout->count())));
+    }
+    else
+    {
+      hasEvent = SDL_PollEvent(&evt);
+    }
+    CappingProfiler::getInstance()->markWakeUp(CappingProfiler::clock::now() - start);
+
+    while (hasEvent)
+    {
+      if (evt.type != m_wakeUpEvent)
+      {
+        auto event = toUEvent(evt, resolutionScale());
+        sendEvent(event);
+      }
+      hasEvent = SDL_PollEvent(&evt);
+    }
+  }
+
+  // Wakes up waitEvent, it's safe to be called on any thread
+  void wakeUp()
+  {
+    if (m_wakeUpEvent == (Uint32)-1)
+    {
+      return;
+    }
+    SDL_Event evt;
+    SDL_zero(evt);
+    evt.type = m_wakeUpEvent;
+    SDL_PushEvent(&evt);
+  }
+
   void swapBuffer()
   {
     // auto profiler = CappingProfiler::getInstance();
@@ -36,6 +36,7 @@
 #include "Application/VggEnv.hpp"
 #include "Layer/Graphics/GraphicsContext.hpp"
 #include "SdlMouse.hpp"
+#include "Utility/CappingProfiler.hpp"
 #include "Utility/ConfigManager.hpp"
 #include "Utility/Log.hpp"
 #include "Utility/Version.hpp"
@@ -119,13 +120,30 @@ int main(int argc, char** argv)
   controller->start(darumaFileOrDir, "../asset/vgg-format.json", "../asset/vgg_layout.json");
   app->setController(controller);
 
+  // The loop sleeps while idle. It wakes up on the next event, when the next frame is allowed if a
+  // paint is needed, when the next item on the run loop is due, when an earlier item is scheduled
+  // from another thread, or when a pending tile is rasterized in the background.
+  auto runLoop = mainComposer.runLoop();
+  runLoop->setWakeUp([sdlApp]() { sdlApp->wakeUp(); });
+
+  std::optional<CappingProfiler::dms> timeout = CappingProfiler::dms{ 0 };
   while (!sdlApp->shouldExit())
   {
-    sdlApp->poll();
+    sdlApp->waitEvent(timeout);
     app->paint(cfg.renderFPSLimit);
-    mainComposer.runLoop()->dispatch();
+    runLoop->dispatch();
+    timeout = app->idleTimeout(cfg.renderFPSLimit, *runLoop);
   }
 
+  runLoop->setWakeUp(nullptr);
+
+  const auto stats = CappingProfiler::getInstance()->stats();
+  INFO("frames: %llu, wake ups: %llu, idle: %.0f ms, average frame duration: %.2f ms",
+       static_cast<unsigned long long>(stats.frames),
+       static_cast<unsigned long long>(stats.wakeUps),
+       stats.idleDuration,
+       stats.averageFrameDuration);
+
   VGG::Environment::tearDown();
   return 0;
 }
@@ -0,0 +1,181 @@
+/*
+ * Copyright 2023-2024 VeryGoodGraphics LTD <bd@verygoodgraphics.com>
+ *
+ * Licensed under the VGG License, Version 1.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.verygoodgraphics.com/licenses/LICENSE-1.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "DamageRegion.hpp"
+#include "Utility/Log.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <mutex>
+
+namespace
+{
+using VGG::layer::Bounds;
+
+double areaOf(const Bounds& b)
+{
+  return b.valid() ? double(b.width()) * double(b.height()) : 0.0;
+}
+
+// The area wasted by drawing the union of the two rects instead of both of them, negative if the
+// union is smaller, which happens when they overlap enough.
+double mergeCost(const Bounds& a, const Bounds& b)
+{
+  return areaOf(a.unionAs(b)) - areaOf(a) - areaOf(b);
+}
+
+bool contains(const Bounds& outer, const Bounds& inner)
+{
+  return outer.unionAs(inner) == outer;
+}
+
+std::mutex              s_statsMutex;
+VGG::layer::DamageStats s_stats;
+} // namespace
+
+namespace VGG::layer
+{
+
+DamageRegion::DamageRegion(size_t maxRects)
+  : m_maxRects(std::max<size_t>(maxRects, 1))
+{
+}
+
+void DamageRegion::setGrid(const Bounds& bounds, float cellWidth, float cellHeight)
+{
+  ASSERT(cellWidth > 0 && cellHeight > 0);
+  m_grid = Grid{ bounds, cellWidth, cellHeight };
+}
+
+void DamageRegion::add(const Bounds& rect)
+{
+  auto r = m_grid ? rect.intersectAs(m_grid->bounds) : rect;
+  if (!r.valid())
+  {
+    return;
+  }
+  m_damagedArea += areaOf(r);
+  insert(m_grid ? snap(r) : r);
+}
+
+void DamageRegion::clear()
+{
+  m_rects.clear();
+  m_damagedArea = 0;
+}
+
+double DamageRegion::area() const
+{
+  double area = 0;
+  for (const auto& r : m_rects)
+  {
+    area += areaOf(r);
+  }
+  return area;
+}
+
+Bounds DamageRegion::snap(const Bounds& rect) const
+{
+  const auto& g = *m_grid;
+  const auto  x = g.bounds.x();
+  const auto  y = g.bounds.y();
+  const auto  l = x + std::floor((rect.left() - x) / g.cellWidth) * g.cellWidth;
+  const auto  t = y + std::floor((rect.top() - y) / g.cellHeight) * g.cellHeight;
+  const auto  r = x + std::ceil((rect.right() - x) / g.cellWidth) * g.cellWidth;
+  const auto  b = y + std::ceil((rect.bottom() - y) / g.cellHeight) * g.cellHeight;
+  return Bounds::makeBoundsLRTB(
+    l,
+    std::min(r, g.bounds.right()),
+    t,
+    std::min(b, g.bounds.bottom()));
+}
+
+void DamageRegion::insert(Bounds rect)
+{
+  // The merged rect could be mergeable with the rects checked before, so it's checked again
+  for (bool merged = true; merged;)
+  {
+    merged = false;
+    for (auto it = m_rects.begin(); it != m_rects.end(); ++it)
+    {
+      if (contains(*it, rect))
+      {
+        return;
+      }
+      if (mergeCost(*it, rect) <= 0)
+      {
+        rect.unionWith(*it);
+        m_rects.erase(it);
+        merged = true;
+        break;
+      }
+    }
+  }
+  m_rects.push_back(rect);
+  reduce();
+}
+
+void DamageRegion::reduce()
+{
+  if (m_rects.size() <= m_maxRects)
+  {
+    return;
+  }
+
+  size_t first = 0;
+  size_t second = 1;
+  double minCost = std::numeric_limits<double>::max();
+  for (size_t i = 0; i < m_rects.size(); ++i)
+  {
+    for (size_t j = i + 1; j < m_rects.size(); ++j)
+    {
+      if (const auto cost = mergeCost(m_rects[i], m_rects[j]); cost < minCost)
+      {
+        minCost = cost;
+        first = i;
+        second = j;
+      }
+    }
+  }
+
+  const auto merged = m_rects[first].unionAs(m_rects[second]);
+  m_rects.erase(m_rects.begin() + second);
+  m_rects.erase(m_rects.begin() + first);
+  insert(merged);
+}
+
+void recordDamage(const DamageRegion& region)
+{
+  std::lock_guard<std::mutex> lock(s_statsMutex);
+  s_stats.updateCount++;
+  s_stats.rectCount += region.rects().size();
+  s_stats.damagedArea += region.damagedArea();
+  s_stats.rasterArea += region.area();
+}
+
+DamageStats damageStats()
+{
+  std::lock_guard<std::mutex> lock(s_statsMutex);
+  return s_stats;
+}
+
+void resetDamageStats()
+{
+  std::lock_guard<std::mutex> lock(s_statsMutex);
+  s_stats = DamageStats();
+}
+
+} // namespace VGG::layer
@@ -0,0 +1,87 @@
+/*
+ * Copyright 2023-2024 VeryGoodGraphics LTD <bd@verygoodgraphics.com>
+ *
+ * Licensed under the VGG License, Version 1.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.verygoodgraphics.com/licenses/LICENSE-1.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include "Layer/Core/VBounds.hpp"
+#include "Layer/GlobalSettings.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace VGG::layer
+{
+
+// A damaged region as a short list of rects.
+//
+// Two rects are merged only if their union is not larger than both of them, so the damages far
+// from each other stay apart. Once the list exceeds the limit, the pair whose union wastes the
+// least area is merged. The rects could be snapped outward to a grid, e.g. the cells of a tile,
+// which keeps them integral and makes the neighbouring damages merge exactly.
+class DamageRegion
+{
+public:
+  static constexpr size_t DEFAULT_MAX_RECTS = 8;
+
+  explicit DamageRegion(size_t maxRects = DEFAULT_MAX_RECTS);
+
+  // The added rects are clamped to the bounds and snapped outward to the cells of the grid, which
+  // starts at the top left of the bounds.
+  void setGrid(const Bounds& bounds, float cellWidth, float cellHeight);
+
+  void add(const Bounds& rect);
+  void clear();
+
+  const std::vector<Bounds>& rects() const
+  {
+    return m_rects;
+  }
+
+  bool empty() const
+  {
+    return m_rects.empty();
+  }
+
+  // The sum of the areas of the added rects, before they are snapped and merged
+  double damagedArea() const
+  {
+    return m_damagedArea;
+  }
+
+  // The sum of the areas of the rects to redraw
+  double area() const;
+
+private:
+  struct Grid
+  {
+    Bounds bounds;
+    float  cellWidth;
+    float  cellHeight;
+  };
+
+  Bounds snap(const Bounds& rect) const;
+  void   insert(Bounds rect);
+  void   reduce();
+
+  std::optional<Grid> m_grid;
+  std::vector<Bounds> m_rects;
+  size_t              m_maxRects;
+  double              m_damagedArea{ 0 };
+};
+
+// Accumulates the region redrawn by a damage update into damageStats()
+void recordDamage(const DamageRegion& region);
+
+} // namespace VGG::layer
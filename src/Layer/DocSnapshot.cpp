@@ -0,0 +1,173 @@
+/*
+ * Copyright 2023-2024 VeryGoodGraphics LTD <bd@verygoodgraphics.com>
+ *
+ * Licensed under the VGG License, Version 1.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.verygoodgraphics.com/licenses/LICENSE-1.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "Layer/DocSnapshot.hpp"
+#include "Domain/Model/DesignModel.hpp"
+#include "Domain/Model/Element.hpp"
+#include "Utility/Log.hpp"
+#include "Utility/Version.hpp"
+
+#include <core/SkData.h>
+#include <src/core/SkMD5.h>
+#include <VGGVersion_generated.h>
+
+#include <cstdint>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace
+{
+using namespace VGG;
+
+// The z order of the flex containers is a flag of the elements, it's not in the model
+void collectFirstOnTop(const Domain::Element& element, std::vector<std::string>& ids)
+{
+  if (element.isFirstOnTop() && !element.id().empty())
+  {
+    ids.push_back(element.id());
+  }
+  for (const auto& child : element.children())
+  {
+    collectFirstOnTop(*child, ids);
+  }
+}
+
+void restoreFirstOnTop(Domain::Element& element, const std::unordered_set<std::string>& ids)
+{
+  element.setFirstOnTop(ids.find(element.id()) != ids.end());
+  for (const auto& child : element.children())
+  {
+    restoreFirstOnTop(*child, ids);
+  }
+}
+
+// Unique among the processes and threads writing into the same directory
+std::string tempSuffix()
+{
+  std::random_device rd;
+  std::ostringstream os;
+  os << ".tmp." << std::this_thread::get_id() << '.' << std::hex << rd() << rd();
+  return os.str();
+}
+} // namespace
+
+namespace VGG::entry
+{
+
+std::string DocSnapshot::key(const nlohmann::json& design, const nlohmann::json& layout)
+{
+  SkMD5 md5;
+  auto  write = [&md5](const std::string& text)
+  {
+    // Each input is prefixed by its size, so the bytes can't shift from one to the other
+    const uint64_t size = text.size();
+    md5.write(&size, sizeof(size));
+    md5.write(text.data(), text.size());
+  };
+  // The expansion and layout code of another build might produce another document
+  write(Version::get());
+  write(VGG_PARSE_FORMAT_VER_STR);
+  write(design.dump());
+  write(layout.dump());
+  return md5.finish().toLowercaseHexString().c_str();
+}
+
+std::filesystem::path DocSnapshot::path(const std::filesystem::path& dir, const std::string& key)
+{
+  return dir / (key + ".v" + std::to_string(VERSION) + ".snapshot");
+}
+
+std::shared_ptr<Domain::DesignDocument> DocSnapshot::load(
+  const std::filesystem::path& dir,
+  const std::string&           key)
+{
+  const auto filename = path(dir, key);
+  // the file is memory mapped, the data is not copied
+  auto data = SkData::MakeFromFileName(filename.string().c_str());
+  if (!data)
+  {
+    return nullptr;
+  }
+
+  try
+  {
+    const auto* bytes = data->bytes();
+    const auto  snapshot = nlohmann::json::from_cbor(bytes, bytes + data->size());
+    if (snapshot.value("version", 0) != VERSION || snapshot.value("key", "") != key)
+    {
+      WARN("DocSnapshot::load: mismatched snapshot, %s", filename.string().c_str());
+      return nullptr;
+    }
+
+    auto doc =
+      std::make_shared<Domain::DesignDocument>(snapshot.at("design").get<Model::DesignModel>());
+    doc->buildSubtree();
+    const auto firstOnTop = snapshot.at("firstOnTop").get<std::unordered_set<std::string>>();
+    restoreFirstOnTop(*doc, firstOnTop);
+    return doc;
+  }
+  catch (const nlohmann::json::exception& e)
+  {
+    WARN("DocSnapshot::load: invalid snapshot, %s, %s", filename.string().c_str(), e.what());
+    return nullptr;
+  }
+}
+
+void DocSnapshot::save(
+  const std::filesystem::path&  dir,
+  const std::string&            key,
+  const Domain::DesignDocument& doc)
+{
+  std::vector<std::string> firstOnTop;
+  collectFirstOnTop(doc, firstOnTop);
+
+  nlohmann::json snapshot;
+  snapshot["version"] = VERSION;
+  snapshot["key"] = key;
+  snapshot["design"] = doc.treeModel(false);
+  snapshot["firstOnTop"] = std::move(firstOnTop);
+  const auto bytes = nlohmann::json::to_cbor(snapshot);
+
+  // Written aside then renamed, so a concurrent reader never maps a partial snapshot. The writers
+  // of the same snapshot write their own files, the last one renamed replaces the others.
+  std::error_code ec;
+  std::filesystem::create_directories(dir, ec);
+  const auto filename = path(dir, key);
+  auto       tmp = filename;
+  tmp += tempSuffix();
+  bool written = false;
+  {
+    std::ofstream ofs{ tmp, std::ios::binary | std::ios::trunc };
+    written = ofs.write(reinterpret_cast<const char*>(bytes.data()), bytes.size()).good();
+  }
+  if (!written)
+  {
+    WARN("DocSnapshot::save: failed to write, %s", tmp.string().c_str());
+    std::filesystem::remove(tmp, ec);
+    return;
+  }
+  std::filesystem::rename(tmp, filename, ec);
+  if (ec)
+  {
+    WARN("DocSnapshot::save: failed to rename, %s", filename.string().c_str());
+    std::filesystem::remove(tmp, ec);
+  }
+}
+
+} // namespace VGG::entry
@@ -28,6 +28,7 @@
 #include <svg/SkSVGCanvas.h>
 #include <src/xml/SkXMLWriter.h>
 #include <core/SkCanvas.h>
+#include <core/SkPictureRecorder.h>
 #include <encode/SkPngEncoder.h>
 #include <encode/SkJpegEncoder.h>
 #include <encode/SkWebpEncoder.h>
@@ -162,6 +163,10 @@ std::optional<std::vector<char>> makeImage(const ImageOptions& opts, SkSurface*
   {
     if (opts.encode != EImageEncode::IE_RAW)
     {
+      if (!ctx) // raster surface
+      {
+        return encodeImage(nullptr, opts.encode, image.get(), opts.quality);
+      }
       if (auto dc = ctx->asDirectContext())
       {
         return encodeImage(dc, opts.encode, image.get(), opts.quality);
@@ -180,4 +185,44 @@ std::optional<std::vector<char>> makeImage(const ImageOptions& opts, SkSurface*
   }
   return std::nullopt;
 }
+
+sk_sp<SkPicture> makePicture(layer::FrameNode* frame)
+{
+  ASSERT(frame);
+  frame->revalidate();
+  const auto&       b = frame->bounds();
+  SkPictureRecorder rec;
+  auto              canvas = rec.beginRecording(SkRect::MakeWH(b.width(), b.height()));
+  canvas->translate(-b.x(), -b.y());
+  VGG::layer::Renderer r;
+  r = r.createNew(canvas);
+  frame->render(&r);
+  return rec.finishRecordingAsPicture();
+}
+
+std::optional<std::vector<char>> makeImage(
+  const ImageOptions& opts,
+  const SkPicture*    picture,
+  float               scale)
+{
+  ASSERT(picture);
+  if (opts.encode == EImageEncode::IE_RAW)
+  {
+    DEBUG("raw data is not supported now");
+    return std::nullopt;
+  }
+  auto surface = SkSurfaces::Raster(SkImageInfo::MakeN32Premul(opts.extend[0], opts.extend[1]));
+  if (!surface)
+  {
+    DEBUG("Failed to create raster surface [%d, %d]", opts.extend[0], opts.extend[1]);
+    return std::nullopt;
+  }
+  auto canvas = surface->getCanvas();
+  canvas->clear(SK_ColorWHITE);
+  canvas->translate(-opts.position[0], -opts.position[1]);
+  canvas->scale(scale, scale);
+  canvas->drawPicture(picture);
+  auto image = surface->makeImageSnapshot();
+  return image ? encodeImage(nullptr, opts.encode, image.get(), opts.quality) : std::nullopt;
+}
 } // namespace VGG::layer::exporter
@@ -130,7 +130,8 @@ public:
     const std::string&       key,
     std::vector<fs::path>    dirs,
     std::vector<std::string> fallbacks,
-    std::vector<std::string> fallbackEmojiFonts)
+    std::vector<std::string> fallbackEmojiFonts,
+    fs::path                 indexFile = {})
   {
 
 #ifdef VGG_LAYER_DEBUG
@@ -140,7 +141,7 @@ public:
       VGG_FONT_LOG("{}", p.string());
     }
 #endif
-    sk_sp<SkFontMgrVGG> vggFontMgr = VGGFontDirectory(std::move(dirs));
+    sk_sp<SkFontMgrVGG> vggFontMgr = VGGFontDirectory(std::move(dirs), std::move(indexFile));
     if (vggFontMgr)
     {
 #ifdef VGG_USE_EMBBED_FONT
@@ -203,13 +204,21 @@ FontManager::FontManager()
     dirs.push_back(ds);
   std::vector<std::string> fallbackFonts(arrayEntries("fallbackFont"));
   std::vector<std::string> fallbackEmojiFonts(arrayEntries("fallbackEmojiFont"));
+  // The faces of the font files are cached in the index file, the files are scanned on every
+  // startup if it's not given
+  std::string indexFile;
+  if (font.is_object())
+  {
+    indexFile = font.value("indexFile", std::string());
+  }
   if (!dirs.empty())
   {
     auto mgr = d_ptr->registerFont(
       "default",
       std::move(dirs),
       std::move(fallbackFonts),
-      std::move(fallbackEmojiFonts));
+      std::move(fallbackEmojiFonts),
+      indexFile);
     d_ptr->defaultFontMgr = mgr;
     atLeastOne = true;
   }
@@ -64,15 +64,59 @@ class FrameNode__pImpl
 {
   VGG_DECL_API(FrameNode)
 public:
-  Ref<PaintNode> node;
+  Ref<PaintNode>     node;
+  FrameNode::Builder builder;
+  std::string        guid;
+  int                uniqueID{ 0 };
+  bool               visible{ true }; // applied to the root node when it's built
 
   bool maskDirty{ true };
 
+  std::unordered_map<int, PaintNodeRef> nodeIndex; // uniqueID -> node in the frame
+
+  // The paint nodes recorded in the local space of the frame, it's recorded again only when the
+  // frame is revalidated, so the scene picture references the unchanged frames as they are.
+  sk_sp<SkPicture> picture;
+
   FrameNode__pImpl(FrameNode* api)
     : q_ptr(api)
   {
   }
 
+  void build()
+  {
+    if (node || !builder)
+      return;
+    node = builder();
+    ASSERT(node);
+    node->setVisible(visible);
+    q_ptr->observe(node);
+    maskDirty = true;
+  }
+
+  void buildNodeIndex(PaintNode* ptr)
+  {
+    nodeIndex.try_emplace(ptr->uniqueID(), ptr); // the first one in pre-order wins
+    for (const auto& c : *ptr)
+    {
+      buildNodeIndex(static_cast<PaintNode*>(c.get()));
+    }
+  }
+
+  PaintNode* indexedNode(int id) const
+  {
+    auto it = nodeIndex.find(id);
+    if (it == nodeIndex.end())
+      return nullptr;
+    auto n = it->second.lock();
+    if (!n || n->uniqueID() != id)
+      return nullptr;
+    auto root = n;
+    while (auto p = root->parent())
+      root = p;
+    return root.get() == node.get() ? n.get() : nullptr; // it might be removed from the frame
+  }
+
   sk_sp<SkPicture> renderPicture(const SkRect& bounds)
   {
     Renderer          r;
@@ -86,10 +130,28 @@ public:
 
 PaintNode* FrameNode::node() const
 {
+  d_ptr->build();
   ASSERT(d_ptr->node);
   return d_ptr->node.get();
 }
 
+bool FrameNode::isBuilt() const
+{
+  return d_ptr->node;
+}
+
+void FrameNode::release()
+{
+  VGG_IMPL(FrameNode);
+  if (!_->node || !_->builder)
+    return;
+  _->visible = _->node->isVisible();
+  unobserve(_->node);
+  _->node = nullptr;
+  _->nodeIndex.clear();
+  _->picture = nullptr;
+}
+
 // const Transform& FrameNode::transform() const
 // {
 //   return d_ptr->transform;
@@ -97,18 +159,40 @@ PaintNode* FrameNode::node() const
 
 const std::string& FrameNode::guid() const
 {
-  return node()->guid();
+  return d_ptr->node ? d_ptr->node->guid() : d_ptr->guid;
+}
+
+int FrameNode::uniqueID() const
+{
+  return d_ptr->uniqueID;
+}
+
+void FrameNode::setVisible(bool visible)
+{
+  d_ptr->visible = visible;
+  if (d_ptr->node)
+    d_ptr->node->setVisible(visible);
 }
 
 bool FrameNode::isVisible() const
 {
-  return node()->isVisible();
+  return d_ptr->node ? d_ptr->node->isVisible() : d_ptr->visible;
 }
 
 void FrameNode::render(Renderer* renderer)
 {
+  if (!isVisible())
+  {
+    // A hidden lazy frame draws nothing, so don't build it just to find that out
+    return;
+  }
   SkAutoCanvasRestore acr(renderer->canvas(), true);
   renderer->canvas()->concat(toSkMatrix(getTransform()->getMatrix()));
+  if (d_ptr->picture && !isInvalid())
+  {
+    renderer->canvas()->drawPicture(d_ptr->picture);
+    return;
+  }
   node()->render(renderer);
 }
 
@@ -128,8 +212,7 @@ void FrameNode::debug(Renderer* render)
 
 Bounds FrameNode::effectBounds() const
 {
-  DEBUG("Does not support effectBounds for Frame so far");
-  return node()->bounds();
+  return node()->effectBounds().map(getTransform()->getMatrix());
 }
 
 Bounds FrameNode::onRevalidate(Revalidation* inv, const glm::mat3& ctm)
@@ -143,7 +226,7 @@ Bounds FrameNode::onRevalidate(Revalidation* inv, const glm::mat3& ctm)
   getTransform()->revalidate();
   const auto matrix = getTransform()->getMatrix();
   const auto bounds = node()->revalidate(inv, ctm * matrix);
-  //_->cache = _->renderPicture(toSkRect(bounds));
+  _->picture = _->renderPicture(toSkRect(node()->effectBounds()));
   return bounds.map(matrix);
 }
 
@@ -154,14 +237,36 @@ FrameNode::FrameNode(VRefCnt* cnt, Ref<TransformNode> transform, PaintNodePtr ro
   , d_ptr(std::make_unique<FrameNode__pImpl>(this))
 {
   d_ptr->node = std::move(root);
+  d_ptr->uniqueID = d_ptr->node->uniqueID();
   observe(d_ptr->node);
 #ifdef VGG_LAYER_DEBUG
   dbgInfo = "Frame Node for " + d_ptr->node->guid();
 #endif
 }
 
+FrameNode::FrameNode(
+  VRefCnt*           cnt,
+  Ref<TransformNode> transform,
+  Builder            builder,
+  std::string        guid,
+  int                uniqueID,
+  bool               visible)
+  : TransformEffectNode(cnt, std::move(transform), 0)
+  , d_ptr(std::make_unique<FrameNode__pImpl>(this))
+{
+  d_ptr->builder = std::move(builder);
+  d_ptr->guid = std::move(guid);
+  d_ptr->uniqueID = uniqueID;
+  d_ptr->visible = visible;
+#ifdef VGG_LAYER_DEBUG
+  dbgInfo = "Frame Node for " + d_ptr->guid;
+#endif
+}
+
 void FrameNode::nodeAt(int x, int y, NodeVisitor vistor, void* userData)
 {
+  if (!isVisible()) // hidden frames are not hit and not built for the test
+    return;
   ASSERT(node()->parent() == nullptr);
   if (bounds().contains(x, y))
   {
@@ -180,16 +285,28 @@ void FrameNode::invalidateMask()
 
 PaintNode* FrameNode::nodeByID(int id)
 {
-  if (auto r = node(); r)
+  VGG_IMPL(FrameNode);
+  auto r = node();
+  if (!r)
+    return nullptr;
+  if (auto n = _->indexedNode(id))
+    return n;
+
+  // The index is only rebuilt if the node is in the frame, so that looking up the ids of other
+  // frames costs no more than a scan.
+  auto n = findByID(r, id);
+  if (n)
   {
-    return findByID(r, id);
+    _->nodeIndex.clear();
+    _->buildNodeIndex(r);
   }
-  return nullptr;
+  return n;
 }
 
 FrameNode::~FrameNode()
 {
-  unobserve(d_ptr->node);
+  if (d_ptr->node)
+    unobserve(d_ptr->node);
 }
 
 } // namespace VGG::layer
@@ -16,14 +16,34 @@
 
 #include "Layer/GlobalSettings.hpp"
 #include "Layer/Config.hpp"
+#include "Utility/ConfigManager.hpp"
 
 #include <stdlib.h>
+#include <algorithm>
 #include <initializer_list>
+#include <optional>
+#include <thread>
 
 namespace
 {
-bool g_enableAnimatedPattern = true;
+bool               g_enableAnimatedPattern = true;
+std::optional<int> g_rasterThreadCount; // read from the config on first use if not set
+
+int configuredRasterThreadCount()
+{
+  auto raster = Config::globalConfig().value("raster", nlohmann::json{});
+  if (raster.is_object() && raster.contains("threadCount"))
+  {
+    return raster.value("threadCount", 0);
+  }
+#ifdef EMSCRIPTEN
+  return 0;
+#else
+  // leaves a core for the render thread
+  return std::max(1, (int)std::thread::hardware_concurrency() - 1);
+#endif
 }
+} // namespace
 
 namespace VGG::layer
 {
@@ -38,6 +58,20 @@ bool isAnimatedPatternEnabled()
   return g_enableAnimatedPattern;
 }
 
+int rasterThreadCount()
+{
+  if (!g_rasterThreadCount)
+  {
+    setRasterThreadCount(configuredRasterThreadCount());
+  }
+  return *g_rasterThreadCount;
+}
+
+void setRasterThreadCount(int count)
+{
+  g_rasterThreadCount = std::max(0, count);
+}
+
 void setupEnv()
 {
   static struct
@@ -17,6 +17,7 @@
 
 #include "Utility/Log.hpp"
 
+#include <algorithm>
 #include <unordered_map>
 #include <list>
 
@@ -28,13 +29,15 @@ class LRUCache
 private:
   struct Entry
   {
-    Entry(const K& key, V&& value)
+    Entry(const K& key, V&& value, size_t cost)
       : key(key)
       , value(std::move(value))
+      , cost(cost)
     {
     }
-    K key;
-    V value;
+    K      key;
+    V      value;
+    size_t cost;
     ~Entry()
     {
     }
@@ -64,12 +67,21 @@ public:
     return nullptr;
   }
 
-  V* insert(const K& key, V value)
+  // Unlike find(), the entry is not moved to the head
+  bool contains(const K& key) const
+  {
+    return m_map.find(key) != m_map.end();
+  }
+
+  // cost is an arbitrary unit (e.g. bytes) accumulated by totalCost(), which could be used to
+  // evict entries by evict(cost)
+  V* insert(const K& key, V value, size_t cost = 1)
   {
     ASSERT(m_map.find(key) == m_map.end());
-    Entry* entry = new Entry(key, std::move(value));
+    Entry* entry = new Entry(key, std::move(value), cost);
     m_lru.push_front(entry);
     m_map[key] = m_lru.begin();
+    m_totalCost += cost;
     while ((int)m_map.size() > m_maxCount)
     {
       if (!m_lru.empty())
@@ -80,23 +92,60 @@ public:
     return &(entry->value);
   }
 
-  V* insertOrUpdate(const K& key, V value)
+  V* insertOrUpdate(const K& key, V value, size_t cost = 1)
   {
     if (auto it = m_map.find(key); it != m_map.end())
     {
       auto entry = *(it->second);
       entry->value = std::move(value);
+      m_totalCost = m_totalCost - entry->cost + cost;
+      entry->cost = cost;
       return &(entry->value);
     }
     else
     {
-      return this->insert(key, std::move(value));
+      return this->insert(key, std::move(value), cost);
     }
   }
 
   int count() const
   {
-    return m_map.count();
+    return (int)m_map.size();
+  }
+
+  size_t totalCost() const
+  {
+    return m_totalCost;
+  }
+
+  // Evicts the least recently used entries until at least the given cost is released or the cache
+  // is empty. Returns the released cost.
+  size_t evict(size_t cost)
+  {
+    size_t released = 0;
+    while (released < cost && !m_lru.empty())
+    {
+      released += (*std::prev(m_lru.end()))->cost;
+      this->remove(std::prev(m_lru.end()));
+    }
+    return released;
+  }
+
+  // Shrinks the values from the least recently used one until at least the given cost is
+  // released, none of them is evicted or moved. The shrinker returns the cost it released from a
+  // value. Returns the released cost.
+  template<typename F>
+  size_t shrink(size_t cost, F&& shrinker)
+  {
+    size_t released = 0;
+    for (auto it = m_lru.rbegin(); released < cost && it != m_lru.rend(); ++it)
+    {
+      const auto r = std::min<size_t>((*it)->cost, shrinker((*it)->value));
+      (*it)->cost -= r;
+      m_totalCost -= r;
+      released += r;
+    }
+    return released;
   }
 
   void purge()
@@ -107,16 +156,14 @@ public:
       delete *it;
     }
     m_lru.clear();
+    m_totalCost = 0;
   }
 
   void remove(const K& key)
   {
     if (auto it = m_map.find(key); it != m_map.end())
     {
-      delete *it;
-      m_lru.erase(it);
-      m_map.erase(key);
-      ASSERT(key == it->key);
+      this->remove(it->second);
     }
   }
 
@@ -141,9 +188,11 @@ private:
   LRUMapType  m_map;
   LRUListType m_lru;
   int         m_maxCount;
+  size_t      m_totalCost{ 0 };
 
   void remove(typename LRUListType::iterator it)
   {
+    m_totalCost -= (*it)->cost;
     m_map.erase((*it)->key);
     delete *it; // delete the entry wrapper
     m_lru.erase(it);
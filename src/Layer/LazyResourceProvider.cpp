@@ -0,0 +1,92 @@
+/*
+ * Copyright 2023-2024 VeryGoodGraphics LTD <bd@verygoodgraphics.com>
+ *
+ * Licensed under the VGG License, Version 1.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.verygoodgraphics.com/licenses/LICENSE-1.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Layer/Core/LazyResourceProvider.hpp"
+#include "Layer/LayerCache.h"
+
+namespace VGG::layer
+{
+
+LazyResourceProvider::LazyResourceProvider(Fetcher fetcher)
+  : m_fetcher(std::move(fetcher))
+{
+  getGlobalImageStackCache()->purge();
+}
+
+LazyResourceProvider::~LazyResourceProvider()
+{
+  cancelWarmUp();
+}
+
+void LazyResourceProvider::cancelWarmUp()
+{
+  if (m_warmUp.valid())
+  {
+    m_cancelWarmUp = true;
+    m_warmUp.wait();
+    m_cancelWarmUp = false;
+  }
+}
+
+void LazyResourceProvider::warmUp(std::vector<std::string> guids)
+{
+  cancelWarmUp();
+  if (guids.empty())
+    return;
+  m_warmUp = std::async(
+    std::launch::async,
+    [this, guids = std::move(guids)]()
+    {
+      for (const auto& guid : guids)
+      {
+        if (m_cancelWarmUp)
+          return;
+        readData(guid);
+      }
+    });
+}
+
+void LazyResourceProvider::purge()
+{
+  cancelWarmUp();
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_data.clear();
+  }
+  getGlobalImageStackCache()->purge();
+}
+
+Blob LazyResourceProvider::readData(std::string_view guid)
+{
+  std::string key(guid);
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (auto it = m_data.find(key); it != m_data.end())
+    {
+      return it->second;
+    }
+  }
+
+  // Fetches without the lock, the raster threads and the warm-up might read different resources
+  // at the same time.
+  auto data = m_fetcher ? m_fetcher(guid) : nullptr;
+  if (!data)
+    return nullptr;
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_data.emplace(std::move(key), std::move(data)).first->second;
+}
+} // namespace VGG::layer
@@ -29,6 +29,9 @@
 #include "Layer/Core/PaintNode.hpp"
 #include "Layer/Core/VType.hpp"
 
+#include <core/SkBBHFactory.h>
+#include <core/SkPictureRecorder.h>
+
 #include <optional>
 
 #define VGG_PAINTNODE_LOG(...) VGG_LOG_DEV(LOG, PaintNode, __VA_ARGS__)
@@ -95,6 +98,9 @@ public:
   ContourOption  maskOption;
   bool           visible{ true };
 
+  bool             cacheBoundary{ false };
+  sk_sp<SkPicture> picture; // the recorded subtree of a cache boundary
+
   // std::vector<LayerFX>      layerEffects;
   // std::vector<BackgroundFX> backgroundEffects;
   std::vector<Border> borders;
@@ -109,6 +115,7 @@ public:
   PaintNode::EventHandler paintNodeEventHandler;
   std::optional<VShape>   path;
   Bounds                  bounds;
+  Bounds                  effectBounds; // the bounds with effects, in the parent space
 
   std::array<float, 4> frameRadius{ 0, 0, 0, 0 };
   float                cornerSmooth{ 0 };
@@ -254,11 +261,48 @@ Transform PaintNode::mapTransform(const PaintNode* node) const
   return Transform(mat);
 }
 
+void PaintNode::setCacheBoundary(bool enabled)
+{
+  VGG_IMPL(PaintNode);
+  _->cacheBoundary = enabled;
+  _->picture = nullptr;
+}
+
+bool PaintNode::isCacheBoundary() const
+{
+  return d_ptr->cacheBoundary;
+}
+
+Bounds PaintNode::effectBounds() const
+{
+  return d_ptr->effectBounds;
+}
+
 void PaintNode::render(Renderer* renderer)
 {
   VGG_IMPL(PaintNode);
   if (!isVisible())
     return;
+  if (_->cacheBoundary && !isInvalid())
+  {
+    if (!_->picture)
+    {
+      // The cull rect must cover the effects, or the shadows out of the bounds are culled
+      SkPictureRecorder rec;
+      auto              rt = SkRTreeFactory();
+      auto              r = renderer->createNew(rec.beginRecording(toSkRect(_->effectBounds), &rt));
+      renderContent(&r);
+      _->picture = rec.finishRecordingAsPicture();
+    }
+    renderer->canvas()->drawPicture(_->picture);
+    return;
+  }
+  renderContent(renderer);
+}
+
+void PaintNode::renderContent(Renderer* renderer)
+{
+  VGG_IMPL(PaintNode);
   auto canvas = renderer->canvas();
   {
     SaveLayerContextGuard lcg(
@@ -349,6 +393,19 @@ void PaintNode::nodeAt(int x, int y, NodeVisitor visitor, void* userData)
   }
 }
 
+PaintNode* PaintNode::nodeAt(int x, int y)
+{
+  if (!isVisible() || !bounds().valid() || !bounds().contains(x, y))
+    return nullptr;
+  auto local = getTransform().inverse() * glm::vec3(x, y, 1);
+  for (auto c = rbegin(); c != rend(); ++c)
+  {
+    if (auto hit = (*c)->nodeAt(local.x, local.y); hit)
+      return hit;
+  }
+  return this;
+}
+
 void PaintNode::setMaskBy(std::vector<std::string> masks)
 {
   VGG_IMPL(PaintNode);
@@ -634,7 +691,9 @@ void PaintNode::setFrameBounds(const Bounds& bounds)
 Bounds PaintNode::onRevalidate(Revalidation* inv, const glm::mat3& mat)
 {
   VGG_IMPL(PaintNode);
+  _->picture = nullptr;
 
+  _->effectBounds = Bounds();
   if (!isVisible())
     return Bounds();
 
@@ -649,25 +708,37 @@ Bounds PaintNode::onRevalidate(Revalidation* inv, const glm::mat3& mat)
   }
 
   Bounds bounds = d_ptr->bounds;
+  Bounds childEffectBounds;
   for (const auto& e : m_children)
   {
     bounds.unionWith(e->bounds());
+    if (e->d_ptr->effectBounds.valid())
+      childEffectBounds.unionWith(e->d_ptr->effectBounds);
   }
 
+  Bounds selfEffectBounds = d_ptr->bounds;
   if (_->renderTrait & ERenderTraitBits::RT_RENDER_SELF)
   {
     auto currentNodeBounds =
       _->renderNode->revalidate(inv, ctm); // This will trigger the shape attribute get the
 
     bounds.unionWith(currentNodeBounds);
+    selfEffectBounds.unionWith(currentNodeBounds);
+    if (const auto e = _->renderNode->effectBounds(); e.valid())
+      selfEffectBounds.unionWith(e);
   }
 
   if (overflow() == OF_HIDDEN || overflow() == OF_SCROLL)
   {
+    // The children are clipped by the node bounds, while the effects of the node itself are not
+    _->effectBounds = selfEffectBounds.map(_->transformAttr->getTransform().matrix());
     bounds = d_ptr->bounds;
     return bounds.map(_->transformAttr->getTransform().matrix());
   }
 
+  if (childEffectBounds.valid())
+    selfEffectBounds.unionWith(childEffectBounds);
+  _->effectBounds = selfEffectBounds.bounds(getTransform());
   return bounds.bounds(getTransform());
 }
 const std::string& PaintNode::guid() const
@@ -0,0 +1,145 @@
+/*
+ * Copyright 2023-2024 VeryGoodGraphics LTD <bd@verygoodgraphics.com>
+ *
+ * Licensed under the VGG License, Version 1.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.verygoodgraphics.com/licenses/LICENSE-1.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "RasterCacheBudget.hpp"
+#include "Utility/Log.hpp"
+
+#include <algorithm>
+
+namespace VGG::layer
+{
+
+RasterCacheBudget& RasterCacheBudget::instance()
+{
+  static RasterCacheBudget s_budget;
+  return s_budget;
+}
+
+void RasterCacheBudget::add(Client* client)
+{
+  ASSERT(client);
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (std::find(m_clients.begin(), m_clients.end(), client) == m_clients.end())
+  {
+    m_clients.push_back(client);
+  }
+}
+
+void RasterCacheBudget::remove(Client* client)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_clients.erase(std::remove(m_clients.begin(), m_clients.end(), client), m_clients.end());
+}
+
+void RasterCacheBudget::setBudget(size_t bytes)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_budget = bytes;
+  evictLocked(m_budget);
+}
+
+size_t RasterCacheBudget::budget() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_budget;
+}
+
+size_t RasterCacheBudget::usedBytes() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return usedBytesLocked();
+}
+
+void RasterCacheBudget::enforce()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  evictLocked(m_budget);
+}
+
+void RasterCacheBudget::purge(size_t targetBytes)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_purgeCount++;
+  evictLocked(targetBytes);
+}
+
+RasterCacheStats RasterCacheBudget::stats() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return RasterCacheStats{ .budgetBytes = m_budget,
+                           .usedBytes = usedBytesLocked(),
+                           .evictionCount = m_evictionCount,
+                           .evictedBytes = m_evictedBytes,
+                           .purgeCount = m_purgeCount };
+}
+
+size_t RasterCacheBudget::usedBytesLocked() const
+{
+  size_t used = 0;
+  for (const auto* c : m_clients)
+  {
+    used += c->cachedBytes();
+  }
+  return used;
+}
+
+void RasterCacheBudget::evictLocked(size_t targetBytes)
+{
+  auto used = usedBytesLocked();
+  // The tiles are kept as long as dropping the spare memory is enough
+  for (auto* c : m_clients)
+  {
+    if (used <= targetBytes)
+      break;
+    used -= std::min(used, c->releaseSpareBytes(used - targetBytes));
+  }
+  while (used > targetBytes)
+  {
+    auto it = std::max_element(
+      m_clients.begin(),
+      m_clients.end(),
+      [](const Client* a, const Client* b) { return a->cachedBytes() < b->cachedBytes(); });
+    if (it == m_clients.end())
+      break;
+    const auto released = (*it)->evictBytes(used - targetBytes);
+    if (released == 0)
+      break;
+    m_evictionCount++;
+    m_evictedBytes += released;
+    used -= std::min(used, released);
+  }
+}
+
+size_t rasterCacheBudget()
+{
+  return RasterCacheBudget::instance().budget();
+}
+
+void setRasterCacheBudget(size_t bytes)
+{
+  RasterCacheBudget::instance().setBudget(bytes);
+}
+
+RasterCacheStats rasterCacheStats()
+{
+  return RasterCacheBudget::instance().stats();
+}
+
+void purgeRasterCache(size_t targetBytes)
+{
+  RasterCacheBudget::instance().purge(targetBytes);
+}
+
+} // namespace VGG::layer
@@ -0,0 +1,84 @@
+/*
+ * Copyright 2023-2024 VeryGoodGraphics LTD <bd@verygoodgraphics.com>
+ *
+ * Licensed under the VGG License, Version 1.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.verygoodgraphics.com/licenses/LICENSE-1.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include "Layer/GlobalSettings.hpp"
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace VGG::layer
+{
+
+// A memory budget in bytes shared by all the tile caches.
+//
+// Each cache registers itself as a client and reports the bytes it holds. The budget is enforced
+// by releasing the spare memory of the clients first, then by evicting the least recently used
+// tiles of the largest client, so a cache could exceed its share temporarily within a frame but
+// never across frames.
+class RasterCacheBudget
+{
+public:
+  class Client
+  {
+  public:
+    virtual size_t cachedBytes() const = 0;
+
+    // Evicts at least the given bytes if possible, returns the bytes actually released.
+    virtual size_t evictBytes(size_t bytes) = 0;
+
+    // Releases at least the given bytes if possible without evicting anything, e.g. the memory
+    // that is only kept to speed up the next update. Returns the bytes actually released.
+    virtual size_t releaseSpareBytes(size_t bytes)
+    {
+      return 0;
+    }
+
+    virtual ~Client() = default;
+  };
+
+  static RasterCacheBudget& instance();
+
+  void add(Client* client);
+  void remove(Client* client);
+
+  void setBudget(size_t bytes);
+  size_t budget() const;
+
+  size_t usedBytes() const;
+
+  // Evicts tiles until the used bytes is under the budget
+  void enforce();
+
+  // Evicts tiles until the used bytes is under the given bytes
+  void purge(size_t targetBytes);
+
+  RasterCacheStats stats() const;
+
+private:
+  RasterCacheBudget() = default;
+  size_t usedBytesLocked() const;
+  void   evictLocked(size_t targetBytes);
+
+  mutable std::mutex   m_mutex;
+  std::vector<Client*> m_clients;
+  size_t               m_budget{ 256 * 1024 * 1024 };
+  size_t               m_evictionCount{ 0 };
+  size_t               m_evictedBytes{ 0 };
+  size_t               m_purgeCount{ 0 };
+};
+
+} // namespace VGG::layer
@@ -20,11 +20,13 @@
 
 #include "Layer/Core/ZoomerNode.hpp"
 #include "Layer/LRUCache.hpp"
+#include "Layer/RasterCacheBudget.hpp"
 #include "core/SkCanvas.h"
 #include "core/SkImage.h"
 #include "core/SkPicture.h"
 #include "core/SkSurface.h"
 #include <gpu/ganesh/SkSurfaceGanesh.h>
+#include <limits>
 #include <optional>
 
 namespace
@@ -39,11 +41,16 @@ struct CacheState
   SkRect   rasterBounds;
   int      tileWidth;
   int      tileHeight;
-  CacheState(int size = 40)
+  CacheState(int size = std::numeric_limits<int>::max())
     : tileCache(size)
   {
   }
 
+  size_t tileBytes() const
+  {
+    return (size_t)tileWidth * tileHeight * SkColorTypeBytesPerPixel(kN32_SkColorType);
+  }
+
   void inval()
   {
     m_invalid = true;
@@ -159,7 +166,7 @@ std::vector<Rasterizer::Tile> rasterOrGetTiles(
         tile->r,
         cache.rasterBounds.left(),
         cache.rasterBounds.top());
-      auto v = cache.tileCache.insert(key, { true, { nullptr, rect } });
+      auto v = cache.tileCache.insert(key, { true, { nullptr, rect } }, cache.tileBytes());
       v->second.image = rasterTile(surface, picture, cache.rasterMatrix, rect);
       tiles.push_back(v->second);
     }
@@ -183,7 +190,7 @@ std::vector<Rasterizer::Tile> rasterOrGetTiles(
           rt->r,
           cache.rasterBounds.left(),
           cache.rasterBounds.top());
-        auto v = cache.tileCache.insert(key, { true, { nullptr, rect } });
+        auto v = cache.tileCache.insert(key, { true, { nullptr, rect } }, cache.tileBytes());
         v->second.image = rasterTile(surface, picture, cache.rasterMatrix, rect);
       }
       else if (!tileState->first)
@@ -207,16 +214,51 @@ std::vector<Rasterizer::Tile> rasterOrGetTiles(
 namespace VGG::layer
 {
 
-class RasterCacheTile__pImpl
+class RasterCacheTile__pImpl : public RasterCacheBudget::Client
 {
   VGG_DECL_API(RasterCacheTile);
 
 public:
   std::array<CacheState, ZoomerNode::ZOOM_LEVEL_COUNT + 1> cacheStack;
   sk_sp<SkSurface>                                         surface;
+  size_t                                                   currentCacheIndex{ 0 };
   RasterCacheTile__pImpl(RasterCacheTile* api)
     : q_ptr(api)
   {
+    RasterCacheBudget::instance().add(this);
+  }
+
+  ~RasterCacheTile__pImpl() override
+  {
+    RasterCacheBudget::instance().remove(this);
+  }
+
+  size_t cachedBytes() const override
+  {
+    size_t bytes = 0;
+    for (const auto& c : cacheStack)
+    {
+      bytes += c.tileCache.totalCost();
+    }
+    return bytes;
+  }
+
+  size_t evictBytes(size_t bytes) override
+  {
+    // Levels other than the current one are evicted first
+    size_t released = 0;
+    for (size_t i = 0; i < cacheStack.size() && released < bytes; i++)
+    {
+      if (i != currentCacheIndex)
+      {
+        released += cacheStack[i].tileCache.evict(bytes - released);
+      }
+    }
+    if (released < bytes)
+    {
+      released += cacheStack[currentCacheIndex].tileCache.evict(bytes - released);
+    }
+    return released;
   }
 
   SkSurface* rasterSurface(GrRecordingContext* context, int w, int h)
@@ -282,6 +324,7 @@ std::tuple<uint32_t, std::vector<Rasterizer::Tile>, SkMatrix> RasterCacheTile::o
 
   const size_t cacheIndex = lod < 0 ? _->cacheStack.size() - 1 : lod;
   auto&        cache = _->cacheStack[cacheIndex];
+  _->currentCacheIndex = cacheIndex;
 
   auto       hitMatrix = SkMatrix::I();
   const auto totalMatrix = rasterContext.globalMatrix * rasterContext.localMatrix;
@@ -317,6 +360,7 @@ std::tuple<uint32_t, std::vector<Rasterizer::Tile>, SkMatrix> RasterCacheTile::o
     }
     auto surface = _->rasterSurface(context, cache.tileWidth, cache.tileHeight);
     auto tiles = rasterOrGetTiles(surface, rasterContext.picture, cache, iter, rasterIter);
+    RasterCacheBudget::instance().enforce(); // the returned tiles hold their own images
     return { reason, std::move(tiles), hitMatrix };
   };
 
@@ -1,4 +1,5 @@
 #include "RasterManager.hpp"
+#include "DamageRegion.hpp"
 #include "TileIterator.hpp"
 #include "RasterTask.hpp"
 
@@ -7,34 +8,105 @@
 #include <core/SkColor.h>
 #include <optional>
 #include <vector>
+#include <chrono>
 #include <future>
 
+namespace
+{
+// The damage of a tile is redrawn in cells of this size aligned to the tile, at most in the given
+// number of rects
+constexpr float  DAMAGE_CELL_SIZE = 32;
+constexpr size_t MAX_TILE_DAMAGE_RECTS = 4;
+} // namespace
+
 namespace VGG::layer
 {
 
-void RasterManager::query(const std::vector<Key>& query, std::vector<RasterResult>& result)
+void RasterManager::query(
+  const std::vector<Key>&    keys,
+  std::vector<RasterResult>* ready,
+  std::vector<Key>*          pending,
+  std::vector<Key>*          missing)
+{
+  poll();
+  for (const auto& k : keys)
+  {
+    if (auto res = m_cache.find(k); res)
+    {
+      if (ready)
+        ready->push_back(*res);
+    }
+    else if (auto it = m_pendingTasks.find(k); it != m_pendingTasks.end())
+    {
+      // A deferred task is never ready by itself, it's executed now that its tile is required
+      if (it->second.wait_for(std::chrono::seconds(0)) == std::future_status::deferred)
+      {
+        waitFor(k);
+        if (auto res = m_cache.find(k); res && ready)
+          ready->push_back(*res);
+      }
+      else if (pending)
+      {
+        pending->push_back(k);
+      }
+    }
+    else if (missing)
+    {
+      missing->push_back(k);
+    }
+  }
+}
+
+void RasterManager::poll()
+{
+  for (auto it = m_pendingTasks.begin(); it != m_pendingTasks.end();)
+  {
+    if (it->second.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+    {
+      cacheResult(it->first, it->second.get());
+      it = m_pendingTasks.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+}
+
+void RasterManager::cacheResult(Key index, RasterResult res)
 {
-  wait();
-  // TODO::
+  if (!res.surf)
+  {
+    return; // a cancelled task
+  }
+  const auto bytes = res.bytes();
+  m_cache.insertOrUpdate(index, std::move(res), bytes);
 }
 
-void RasterManager::wait()
+void RasterManager::waitFor(Key index)
 {
-  while (!m_tasks.empty())
+  if (auto it = m_pendingTasks.find(index); it != m_pendingTasks.end())
   {
-    auto& t = m_tasks.front();
-    t.second.wait();
-    auto res = t.second.get();
-    m_cache.insertOrUpdate(t.first, std::move(res));
-    m_tasks.pop();
+    cacheResult(index, it->second.get());
+    m_pendingTasks.erase(it);
   }
 }
 
 std::optional<RasterManager::RasterResult> RasterManager::query(Key index)
 {
-  wait();
-  auto res = m_cache.find(index);
-  if (res)
+  poll();
+  waitFor(index);
+  if (auto res = m_cache.find(index); res)
+  {
+    return *res;
+  }
+  return std::nullopt;
+}
+
+std::optional<RasterManager::RasterResult> RasterManager::find(Key index)
+{
+  poll();
+  if (auto res = m_cache.find(index); res)
   {
     return *res;
   }
@@ -43,9 +115,11 @@ std::optional<RasterManager::RasterResult> RasterManager::query(Key index)
 
 RasterManager::RasterResult RasterManager::syncExecuteRasterTask(std::unique_ptr<RasterTask> task)
 {
+  waitFor(task->index());
   auto       res = m_executor->addRasterTask(std::move(task)).get();
   const auto key = res.index();
-  return *m_cache.insertOrUpdate(key, std::move(res));
+  const auto bytes = res.bytes();
+  return *m_cache.insertOrUpdate(key, std::move(res), bytes);
 }
 
 void RasterManager::appendRasterTask(std::unique_ptr<RasterTask> task)
@@ -53,10 +127,33 @@ void RasterManager::appendRasterTask(std::unique_ptr<RasterTask> task)
   if (task)
   {
     const auto key = task->index();
-    m_tasks.push({ key, m_executor->addRasterTask(std::move(task)) });
+    waitFor(key); // the previous task might be still writing the surface of the tile
+    stamp(*task);
+    m_pendingTasks.emplace(key, m_executor->addRasterTask(std::move(task)));
   }
 }
 
+void RasterManager::prefetchRasterTask(std::unique_ptr<RasterTask> task)
+{
+  if (task && !hasTile(task->index()))
+  {
+    const auto key = task->index();
+    stamp(*task);
+    m_pendingTasks.emplace(key, m_executor->addLowPriorityRasterTask(std::move(task)));
+  }
+}
+
+void RasterManager::stamp(RasterTask& task) const
+{
+  task.m_generation = m_generation;
+  task.m_addedGeneration = m_generation->load(std::memory_order_relaxed);
+}
+
+bool RasterManager::hasTile(Key index) const
+{
+  return m_cache.contains(index) || m_pendingTasks.find(index) != m_pendingTasks.end();
+}
+
 void RasterManager::updateDamage(
   int                 tw,
   int                 th,
@@ -66,53 +163,60 @@ void RasterManager::updateDamage(
   sk_sp<SkPicture>    pic)
 {
   const auto rasterBounds = worldBounds.map(rasterMatrix);
-  std::unordered_map<Key, std::vector<TileTask::Where>>
-    tileDamage; // tile_index -> tile_damage regions
+  struct TileDamage
+  {
+    glm::ivec2   topLeft;
+    DamageRegion region{ MAX_TILE_DAMAGE_RECTS };
+  };
+  std::unordered_map<Key, TileDamage> tileDamage;
   for (const auto& damage : rasterDamageBounds)
   {
     TileIter iter(damage, tw, th, rasterBounds);
     while (auto tile = iter.next())
     {
-      std::vector<TileTask::Where> where;
-      where.reserve(5);
-      const auto key = tile->key();
       const auto tileBounds = tile->bounds().toFloatBounds();
-      if (auto isectBounds = tileBounds.intersectAs(damage); isectBounds.valid())
+      if (!tileBounds.isIntersectWith(damage))
       {
-        where.push_back(TileTask::Where{ .dst = { (int)isectBounds.x() - tile->topLeft().x,
-                                                  (int)isectBounds.y() - tile->topLeft().y },
-                                         .src = isectBounds });
+        continue;
       }
-      if (auto it = tileDamage.find(key); it != tileDamage.end())
+      auto [it, inserted] = tileDamage.try_emplace(tile->key());
+      if (inserted)
       {
-        it->second.insert(
-          it->second.end(),
-          std::move_iterator(where.begin()),
-          std::move_iterator(where.end()));
-      }
-      else
-      {
-        tileDamage.insert({ key, std::move(where) });
+        // the cells are aligned to the tile, so the redrawn rects are integral and inside it
+        it->second.topLeft = tile->topLeft();
+        it->second.region.setGrid(tileBounds, DAMAGE_CELL_SIZE, DAMAGE_CELL_SIZE);
       }
+      it->second.region.add(damage);
     }
   }
 
-  for (const auto& [k, v] : tileDamage)
+  for (const auto& [k, d] : tileDamage)
   {
-    sk_sp<SkSurface> surf;
+    // Waits for the in-flight task of the tile and redraws the damage on its spare surface, the
+    // surfaces of the tile are owned by the task until it's finished.
     if (auto cache = query(k); cache)
     {
-      surf = std::move(cache->surf);
+      m_cache.remove(k);
+      recordDamage(d.region);
+      std::vector<TileTask::Where> where;
+      where.reserve(d.region.rects().size());
+      for (const auto& r : d.region.rects())
+      {
+        where.push_back(
+          TileTask::Where{ .dst = { (int)r.x() - d.topLeft.x, (int)r.y() - d.topLeft.y },
+                           .src = r });
+      }
+
       auto task = std::make_unique<TileTask>(
         this,
         k,
         tw,
         th,
         SK_ColorTRANSPARENT,
-        std::move(v),
+        std::move(where),
         rasterMatrix,
         pic,
-        std::move(surf));
+        std::move(*cache));
       appendRasterTask(std::move(task));
     }
   }
@@ -120,7 +224,11 @@ void RasterManager::updateDamage(
 
 void RasterManager::update(std::vector<std::unique_ptr<RasterTask>> tasks)
 {
+  // The tasks still queued in the executor, e.g. of the previous scales of a pinch, are skipped
+  // instead of delaying the tiles of the current one.
+  m_generation->fetch_add(1, std::memory_order_relaxed);
   m_cache.purge();
+  m_pendingTasks.clear();
   for (auto& task : tasks)
   {
     appendRasterTask(std::move(task));
@@ -19,13 +19,18 @@
 #include "TileIterator.hpp"
 #include "Layer/Core/VBounds.hpp"
 #include "Layer/LRUCache.hpp"
+#include "Layer/RasterCacheBudget.hpp"
 
 #include <core/SkImage.h>
 #include <core/SkSurface.h>
 #include <core/SkCanvas.h>
 #include <core/SkPicture.h>
-#include <queue>
+#include <atomic>
+#include <cstdint>
 #include <future>
+#include <memory>
+#include <unordered_map>
+#include <limits>
 
 class GrRecordingContext;
 namespace VGG::layer
@@ -33,7 +38,7 @@ namespace VGG::layer
 
 class RasterExecutor;
 
-class RasterManager
+class RasterManager : public RasterCacheBudget::Client
 {
 public:
   using Key = uint64_t;
@@ -42,8 +47,15 @@ public:
   public:
     using Future = std::future<RasterResult>;
     RasterResult() = default;
-    RasterResult(RasterManager* mgr, sk_sp<SkSurface> surf, Key index)
+    // The image of the surface is snapshotted here, once per raster pass of the tile
+    RasterResult(
+      RasterManager*   mgr,
+      sk_sp<SkSurface> surf,
+      Key              index,
+      sk_sp<SkSurface> spare = nullptr)
       : surf(std::move(surf))
+      , image(this->surf ? this->surf->makeImageSnapshot() : nullptr)
+      , spare(std::move(spare))
       , m_mgr(mgr)
       , m_index(index)
     {
@@ -59,7 +71,18 @@ public:
       return m_index;
     }
 
+    size_t bytes() const
+    {
+      return (surf ? surf->imageInfo().computeMinByteSize() : 0) +
+             (spare ? spare->imageInfo().computeMinByteSize() : 0);
+    }
+
     sk_sp<SkSurface> surf = nullptr;
+    sk_sp<SkImage>   image = nullptr; // immutable content of surf, invalid once surf is redrawn
+
+    // The surface of the previous content of the tile. A damage update is drawn on it instead of
+    // surf, which would be copied on write while the image is alive.
+    sk_sp<SkSurface> spare = nullptr;
 
   private:
     RasterManager* m_mgr = nullptr;
@@ -78,11 +101,22 @@ public:
     {
       return m_index;
     }
+
+    // Returns true if the tiles are purged by RasterManager::update since the task was added, its
+    // result would be dropped, so it should return an empty result instead of rasterizing.
+    bool isCancelled() const
+    {
+      return m_generation && m_generation->load(std::memory_order_relaxed) != m_addedGeneration;
+    }
+
     virtual RasterResult execute(GrRecordingContext* context) = 0;
     virtual ~RasterTask() = default;
 
   private:
-    Key m_index;
+    friend class RasterManager;
+    Key                                          m_index;
+    std::shared_ptr<const std::atomic<uint64_t>> m_generation;
+    uint64_t                                     m_addedGeneration{ 0 };
   };
 
   class RasterExecutor : public Executor
@@ -90,17 +124,69 @@ public:
   public:
     virtual RasterManager::RasterResult::Future addRasterTask(
       std::unique_ptr<RasterManager::RasterTask> task) = 0;
+
+    // The task could be postponed by any task added by addRasterTask
+    virtual RasterManager::RasterResult::Future addLowPriorityRasterTask(
+      std::unique_ptr<RasterManager::RasterTask> task)
+    {
+      return addRasterTask(std::move(task));
+    }
+
+    // Returns true if the tasks are executed in the background, so that the results could be
+    // polled without waiting. Otherwise a task is executed on the caller thread, either when it's
+    // added or when its result is required.
+    virtual bool isConcurrent() const
+    {
+      return false;
+    }
+
+    // The context used by the caller thread. Null indicates the tiles are rasterized by the cpu
+    // backend.
+    virtual GrRecordingContext* context()
+    {
+      return nullptr;
+    }
   };
 
+  // The count of the tiles is unlimited, the cache is bounded by the global raster cache budget
   RasterManager(RasterExecutor* executor)
     : m_executor(executor)
-    , m_cache(40)
+    , m_cache(std::numeric_limits<int>::max())
   {
+    RasterCacheBudget::instance().add(this);
+  }
+
+  ~RasterManager() override
+  {
+    RasterCacheBudget::instance().remove(this);
   }
 
   RasterManager(const RasterManager&) = delete;
   RasterManager& operator=(const RasterManager&) = delete;
 
+  size_t cachedBytes() const override
+  {
+    return m_cache.totalCost();
+  }
+
+  size_t evictBytes(size_t bytes) override
+  {
+    return m_cache.evict(bytes);
+  }
+
+  // Drops the spare surfaces of the tiles, the next damage update of a tile allocates a new one
+  size_t releaseSpareBytes(size_t bytes) override
+  {
+    return m_cache.shrink(
+      bytes,
+      [](RasterResult& res)
+      {
+        const auto before = res.bytes();
+        res.spare = nullptr;
+        return before - res.bytes();
+      });
+  }
+
   void updateDamage(
     int                 tw,
     int                 th,
@@ -109,22 +195,53 @@ public:
     const Bounds&       worldBounds,
     sk_sp<SkPicture>    pic);
 
+  // Purges all the tiles and rasterizes the given tasks. The tasks added before are cancelled.
   void update(std::vector<std::unique_ptr<RasterTask>> tasks);
 
+  // The task is executed asynchronously, its result could be polled by poll() or waited by
+  // query() with the key of the task. A tile is not available in the cache while it's being
+  // rasterized.
   void appendRasterTask(std::unique_ptr<RasterTask> task);
 
+  // Speculative tasks for tiles that might be visible soon, executed in low priority
+  void prefetchRasterTask(std::unique_ptr<RasterTask> task);
+
+  // Moves the results of the finished tasks into the cache without blocking
+  void poll();
+
+  // Returns true if the tile is cached or being rasterized
+  bool hasTile(Key index) const;
+
+  // Returns the cached tile without waiting for any task
+  std::optional<RasterResult> find(Key index);
+
   RasterResult syncExecuteRasterTask(std::unique_ptr<RasterTask> task);
 
-  void query(const std::vector<Key>& query, std::vector<RasterResult>& result);
+  // Collects the cached tiles into ready without waiting. The tiles being rasterized are collected
+  // into pending, and the others into missing. Any of the out parameters could be null. The
+  // deferred tasks of the tiles are executed, they are never pending.
+  void query(
+    const std::vector<Key>&    keys,
+    std::vector<RasterResult>* ready,
+    std::vector<Key>*          pending,
+    std::vector<Key>*          missing);
+
+  // Returns the tile, waits for it if it's being rasterized
   std::optional<RasterResult> query(Key index);
 
 private:
   using ResultCache = LRUCache<Key, RasterResult>;
-  using TaskQueue = std::queue<std::pair<Key, std::future<RasterResult>>>;
-  void            wait();
+  using PendingTasks = std::unordered_map<Key, std::future<RasterResult>>;
+  void            waitFor(Key index);
+  void            cacheResult(Key index, RasterResult res);
+  void            stamp(RasterTask& task) const;
   RasterExecutor* m_executor;
   ResultCache     m_cache;
-  TaskQueue       m_tasks;
+  PendingTasks    m_pendingTasks;
+
+  // Shared with the tasks, which might outlive the manager in the executor
+  std::shared_ptr<std::atomic<uint64_t>> m_generation =
+    std::make_shared<std::atomic<uint64_t>>(0);
 };
 
 } // namespace VGG::layer
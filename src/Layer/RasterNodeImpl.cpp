@@ -13,12 +13,12 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include "DamageRegion.hpp"
 #include "RasterTask.hpp"
 #include "VSkia.hpp"
 #include "Renderer.hpp"
 #include "TileIterator.hpp"
 #include "RasterNodeImpl.hpp"
-#include "SimpleRasterExecutor.hpp"
 
 #include "Layer/RasterManager.hpp"
 #include "Layer/Raster.hpp"
@@ -94,7 +94,7 @@ RasterNodeImpl::RasterNodeImpl(
   Ref<RenderNode>                child)
   : RasterNode(
       cnt,
-      static_cast<SimpleRasterExecutor*>(executor)->context(),
+      executor->context(),
       executor,
       std::move(viewport),
       std::move(zoomer),
@@ -110,6 +110,7 @@ RasterNodeImpl::RasterNodeImpl(
 
 void RasterNodeImpl::render(Renderer* renderer)
 {
+  m_hasPendingTiles = false;
   auto c = getChild();
   ASSERT(c);
   if (!c->picture())
@@ -126,37 +127,78 @@ void RasterNodeImpl::render(Renderer* renderer)
     {
       if (auto res = m_rasterMananger->query(0); res)
       {
-        canvas->drawImage(res->surf->makeImageSnapshot(), 0, 0);
+        canvas->drawImage(res->image, 0, 0);
       }
     }
     else
     {
       TileIter it(viewportBoundsInRasterSpace(), m_tw, m_th, worldBoundsInRasterSpace());
       canvas->concat(toSkMatrix(getLocalMatrix()));
+      auto makeTask = [&](RasterManager::Key key, const Boundsi& bounds)
+      {
+        return std::make_unique<TileTask>(
+          m_rasterMananger.get(),
+          key,
+          m_tw,
+          m_th,
+          SK_ColorTRANSPARENT,
+          std::vector{ TileTask::Where{ .dst = { 0, 0 }, .src = bounds.toFloatBounds() } },
+          getRasterMatrix(),
+          sk_ref_sp(c->picture()));
+      };
+      std::unordered_map<RasterManager::Key, Boundsi> tiles;
+      std::vector<RasterManager::Key>                 keys;
       while (auto tile = it.next())
       {
-        const auto key = tile->key();
-        if (auto res = m_rasterMananger->query(key); res)
-        {
-          canvas->drawImage(res->surf->makeImageSnapshot(), tile->topLeft().x, tile->topLeft().y);
-        }
-        else
+        keys.push_back(tile->key());
+        tiles.emplace(tile->key(), tile->bounds());
+      }
+
+      std::vector<RasterManager::RasterResult> ready;
+      std::vector<RasterManager::Key>          pending;
+      std::vector<RasterManager::Key>          missing;
+      m_rasterMananger->query(keys, &ready, &pending, &missing);
+      for (const auto& res : ready)
+      {
+        const auto& b = tiles[res.index()];
+        canvas->drawImage(res.image, b.x(), b.y());
+      }
+
+      // All the missing tiles are dispatched before waiting for any of them, so that they could be
+      // rasterized concurrently by the executor. A non-concurrent executor has rasterized them
+      // once dispatched, so they are queried again and drawn as they are.
+      for (const auto& k : missing)
+      {
+        m_rasterMananger->appendRasterTask(makeTask(k, tiles[k]));
+      }
+      std::vector<RasterManager::RasterResult> dispatched;
+      m_rasterMananger->query(missing, &dispatched, &pending, nullptr);
+      for (const auto& res : dispatched)
+      {
+        const auto& b = tiles[res.index()];
+        canvas->drawImage(res.image, b.x(), b.y());
+      }
+
+      // The tiles still in flight are drawn from the nearest zoom level if possible instead of
+      // waiting for them.
+      std::vector<RasterManager::Key> waiting;
+      for (const auto& k : pending)
+      {
+        if (!m_pyramid.drawPlaceholder(canvas, getRasterMatrix(), tiles[k]))
+          waiting.push_back(k);
+      }
+      m_hasPendingTiles = pending.size() > waiting.size();
+      for (const auto& k : waiting)
+      {
+        if (auto res = m_rasterMananger->query(k); res)
         {
-          auto t = std::make_unique<TileTask>(
-            m_rasterMananger.get(),
-            key,
-            m_tw,
-            m_th,
-            SK_ColorTRANSPARENT,
-            std::vector{
-              TileTask::Where{ .dst = { 0, 0 }, .src = tile->bounds().toFloatBounds() } },
-            getRasterMatrix(),
-            sk_ref_sp(c->picture()),
-            nullptr);
-          auto r = m_rasterMananger->syncExecuteRasterTask(std::move(t));
-          canvas->drawImage(r.surf->makeImageSnapshot(), tile->topLeft().x, tile->topLeft().y);
+          const auto& b = tiles[k];
+          canvas->drawImage(res->image, b.x(), b.y());
         }
       }
+      // Tiles of this frame have been drawn, it's safe to evict any of them now
+      RasterCacheBudget::instance().enforce();
+      prefetch(c->picture());
     }
     canvas->restore();
   }
@@ -193,39 +235,12 @@ void RasterNodeImpl::debug(Renderer* render)
 
 std::vector<Bounds> mergeBounds(std::vector<Bounds> bounds)
 {
-  std::vector<Bounds> merged;
-  std::sort(
-    bounds.begin(),
-    bounds.end(),
-    [](const Bounds& a, const Bounds& b)
-    {
-      const auto aTopLeft = a.topLeft();
-      const auto bTopLeft = b.topLeft();
-      return aTopLeft.y < bTopLeft.y || (aTopLeft.y == bTopLeft.y && aTopLeft.x < bTopLeft.x);
-    });
-  for (auto& b : bounds)
+  DamageRegion region;
+  for (const auto& b : bounds)
   {
-    if (merged.empty())
-    {
-      merged.push_back(b);
-    }
-    else
-    {
-      auto&       last = merged.back();
-      const auto& br = last.bottomRight();
-      const auto& tl = b.topLeft();
-
-      if (br.x >= tl.x && br.y >= tl.y)
-      {
-        last.unionWith(b);
-      }
-      else
-      {
-        merged.push_back(b);
-      }
-    }
+    region.add(b);
   }
-  return merged;
+  return region.rects();
 }
 
 void RasterNodeImpl::raster(const std::vector<Bounds>& bounds)
@@ -261,10 +276,10 @@ void RasterNodeImpl::raster(const std::vector<Bounds>& bounds)
         where.push_back(SurfaceTask::Where{ .dst = { (int)rbx, (int)rby }, .src = worldRect });
       }
     }
-    sk_sp<SkSurface> surf;
+    RasterManager::RasterResult previous;
     if (auto res = m_rasterMananger->query(0); res)
     {
-      surf = std::move(res->surf);
+      previous = std::move(*res);
     }
 
     m_rasterMananger->appendRasterTask(std::make_unique<SurfaceTask>(
@@ -275,14 +290,16 @@ void RasterNodeImpl::raster(const std::vector<Bounds>& bounds)
       getRasterMatrix(),
       std::move(where),
       sk_ref_sp(pic),
-      std::move(surf)));
+      std::move(previous)));
   }
   else
   {
     const auto reason = changeReason(m_prevMatrix, getTransform()->getMatrix());
     m_prevMatrix = getTransform()->getMatrix();
+    updateVelocity(reason & EMatrixChanged::SCALE);
     if ((reason & EMatrixChanged::SCALE))
     {
+      capturePyramidLevel();
       std::vector<std::unique_ptr<RasterManager::RasterTask>> tasks;
       TileIter it(viewportBoundsInRasterSpace(), m_tw, m_th, worldBoundsInRasterSpace());
       while (auto tile = it.next())
@@ -300,8 +317,7 @@ void RasterNodeImpl::raster(const std::vector<Bounds>& bounds)
           SK_ColorTRANSPARENT,
           std::move(where),
           getRasterMatrix(),
-          sk_ref_sp(pic),
-          nullptr);
+          sk_ref_sp(pic));
         tasks.push_back(std::move(task));
       }
 
@@ -309,6 +325,7 @@ void RasterNodeImpl::raster(const std::vector<Bounds>& bounds)
     }
     else if (!bounds.empty())
     {
+      m_pyramid.clear(); // the content of the placeholders is outdated
       auto rasterDamageBounds = bounds;
       for (auto& rb : rasterDamageBounds)
       {
@@ -325,6 +342,112 @@ void RasterNodeImpl::raster(const std::vector<Bounds>& bounds)
     else
     {
     }
+    m_lastRaster = RasterState{ .rasterMatrix = getRasterMatrix(),
+                                .viewportBounds = viewportBoundsInRasterSpace(),
+                                .worldBounds = wr,
+                                .tw = m_tw,
+                                .th = m_th };
+  }
+}
+
+void RasterNodeImpl::capturePyramidLevel()
+{
+  if (!m_lastRaster)
+    return;
+  const auto& last = *m_lastRaster;
+  TileIter    it(last.viewportBounds, last.tw, last.th, last.worldBounds);
+  while (auto tile = it.next())
+  {
+    if (auto res = m_rasterMananger->find(tile->key()); res && res->image)
+    {
+      m_pyramid.addTile(last.rasterMatrix, tile->key(), tile->bounds(), res->image);
+    }
+  }
+}
+
+void RasterNodeImpl::updateVelocity(bool scaleChanged)
+{
+  const auto& local = getLocalMatrix();
+  const auto  translate = glm::vec2{ local[2][0], local[2][1] };
+  if (scaleChanged)
+  {
+    m_velocity = { 0, 0 };
+  }
+  else
+  {
+    // Smooth the velocity so that a single jittered frame doesn't change the direction, and the
+    // velocity decays naturally when the deceleration animation of the scroll view finishes.
+    constexpr float SMOOTH_FACTOR = 0.5f;
+    m_velocity = m_velocity * (1 - SMOOTH_FACTOR) + (translate - m_prevTranslate) * SMOOTH_FACTOR;
+  }
+  m_prevTranslate = translate;
+}
+
+void RasterNodeImpl::prefetch(SkPicture* picture)
+{
+  // A prefetched tile is only useful if it's rasterized in the background, otherwise it would be
+  // either rasterized in this frame or never.
+  if (!executor() || !executor()->isConcurrent())
+    return;
+
+  // The viewport in raster space moves against the translation of the content, predict where it
+  // will be after a few frames and prepare a ring of tiles around it.
+  constexpr float LOOKAHEAD_FRAMES = 8.f;
+  constexpr float MIN_VELOCITY = 0.5f;
+  constexpr int   MAX_PREFETCH_TILES = 8;
+
+  const auto vb = viewportBoundsInRasterSpace();
+  auto       prefetchBounds = vb;
+  if (glm::length(m_velocity) > MIN_VELOCITY)
+  {
+    prefetchBounds.unionWith(
+      Bounds{ vb.topLeft() - m_velocity * LOOKAHEAD_FRAMES, vb.width(), vb.height() });
+  }
+  prefetchBounds = Bounds::makeBoundsLRTB(
+    prefetchBounds.left() - m_tw,
+    prefetchBounds.right() + m_tw,
+    prefetchBounds.top() - m_th,
+    prefetchBounds.bottom() + m_th);
+
+  // Tiles in the moving direction are prefetched first
+  struct Candidate
+  {
+    float              cost;
+    RasterManager::Key key;
+    Boundsi            bounds;
+  };
+  std::vector<Candidate> candidates;
+  const auto             center = vb.topLeft() + vb.size() * 0.5f;
+  const auto             direction =
+    glm::length(m_velocity) > MIN_VELOCITY ? -glm::normalize(m_velocity) : glm::vec2{ 0, 0 };
+  TileIter it(prefetchBounds, m_tw, m_th, worldBoundsInRasterSpace());
+  while (auto tile = it.next())
+  {
+    const auto key = tile->key();
+    if (m_rasterMananger->hasTile(key))
+      continue;
+    const auto tb = tile->bounds();
+    const auto offset = glm::vec2{ tb.x(), tb.y() } + glm::vec2{ m_tw, m_th } * 0.5f - center;
+    candidates.push_back({ glm::length(offset) - glm::dot(offset, direction), key, tb });
+  }
+  std::sort(
+    candidates.begin(),
+    candidates.end(),
+    [](const Candidate& a, const Candidate& b) { return a.cost < b.cost; });
+  if (candidates.size() > MAX_PREFETCH_TILES)
+    candidates.resize(MAX_PREFETCH_TILES);
+
+  for (const auto& c : candidates)
+  {
+    m_rasterMananger->prefetchRasterTask(std::make_unique<TileTask>(
+      m_rasterMananger.get(),
+      c.key,
+      m_tw,
+      m_th,
+      SK_ColorTRANSPARENT,
+      std::vector{ TileTask::Where{ .dst = { 0, 0 }, .src = c.bounds.toFloatBounds() } },
+      getRasterMatrix(),
+      sk_ref_sp(picture)));
   }
 }
 
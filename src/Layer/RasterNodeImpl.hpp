@@ -17,8 +17,11 @@
 #pragma once
 #include "Layer/Core/RasterNode.hpp"
 #include "Layer/RasterManager.hpp"
+#include "Layer/TilePyramid.hpp"
 #include <core/SkColor.h>
 
+class SkPicture;
+
 namespace VGG::layer
 {
 
@@ -40,6 +43,11 @@ public:
 
   void render(Renderer* renderer) override;
 
+  bool hasPendingTiles() const override
+  {
+    return m_hasPendingTiles;
+  }
+
 #ifdef VGG_LAYER_DEBUG
   void debug(Renderer* render) override;
 #endif
@@ -58,10 +66,29 @@ protected:
   Bounds onRevalidate(Revalidation* inv, const glm::mat3& ctm) override;
 
 private:
+  // The raster parameters of the last frame, which are used to keep the tiles of the previous
+  // scale as the placeholders of the next one
+  struct RasterState
+  {
+    glm::mat3 rasterMatrix;
+    Bounds    viewportBounds;
+    Bounds    worldBounds;
+    int       tw, th;
+  };
+
+  void updateVelocity(bool scaleChanged);
+  void prefetch(SkPicture* picture);
+  void capturePyramidLevel();
+
   std::unique_ptr<RasterManager> m_rasterMananger;
   glm::mat3                      m_prevMatrix;
   int                            m_tw, m_th;
   Bounds                         m_viewportBounds;
   Bounds                         m_rasterBounds;
+  glm::vec2                      m_prevTranslate{ 0, 0 };
+  glm::vec2                      m_velocity{ 0, 0 }; // in raster space, pixels per frame
+  TilePyramid                    m_pyramid;
+  std::optional<RasterState>     m_lastRaster;
+  bool                           m_hasPendingTiles{ false };
 };
 } // namespace VGG::layer
@@ -17,6 +17,7 @@
 #include "VSkia.hpp"
 #include "Layer/Core/VBounds.hpp"
 #include "Layer/RasterManager.hpp"
+#include <core/SkPaint.h>
 #include <core/SkPicture.h>
 #include <core/SkSurface.h>
 
@@ -24,11 +25,70 @@
 #include <gpu/GpuTypes.h>
 #include <gpu/ganesh/SkSurfaceGanesh.h>
 
+#include <algorithm>
+
 namespace VGG::layer
 {
 
 class RasterManager;
 
+// Creates a gpu surface if the context is given, otherwise a cpu raster surface, which makes the
+// task able to be executed on any thread.
+inline sk_sp<SkSurface> makeTileSurface(GrRecordingContext* context, int w, int h)
+{
+  const auto info = SkImageInfo::MakeN32Premul(w, h);
+  if (context)
+  {
+    return SkSurfaces::RenderTarget(context, skgpu::Budgeted::kYes, info);
+  }
+  return SkSurfaces::Raster(info);
+}
+
+// Returns the surface to redraw the damage of a tile on, with the previous content of the tile
+// copied unless the whole tile is damaged. The spare surface of the previous result is reused,
+// the surface of the previous image is never written, so it's not copied on write.
+inline sk_sp<SkSurface> makeBackSurface(
+  GrRecordingContext*          context,
+  int                          w,
+  int                          h,
+  SkColor                      bgColor,
+  RasterManager::RasterResult& previous,
+  bool                         fullyDamaged)
+{
+  auto surf = std::move(previous.spare);
+  if (!surf || surf->width() != w || surf->height() != h)
+  {
+    surf = makeTileSurface(context, w, h);
+    ASSERT(surf);
+  }
+
+  auto canvas = surf->getCanvas();
+  const auto& image = previous.image;
+  if (!fullyDamaged && image && image->width() == w && image->height() == h)
+  {
+    SkPaint paint;
+    paint.setBlendMode(SkBlendMode::kSrc);
+    canvas->drawImage(image, 0, 0, SkSamplingOptions(), &paint);
+  }
+  else
+  {
+    canvas->clear(bgColor);
+  }
+  previous.image = nullptr;
+  return surf;
+}
+
+// The surface of the previous result is kept as the spare of the next one if it's still usable
+inline sk_sp<SkSurface> takeSpareSurface(RasterManager::RasterResult& previous, int w, int h)
+{
+  auto surf = std::move(previous.surf);
+  if (surf && (surf->width() != w || surf->height() != h))
+  {
+    return nullptr;
+  }
+  return surf;
+}
+
 class TileTask : public RasterManager::RasterTask
 {
 public:
@@ -46,10 +106,10 @@ public:
     int                tw,
     int                th,
     SkColor            bgColor,
-    std::vector<Where> where,
-    const glm::mat3&   matrix,
-    sk_sp<SkPicture>   picture,
-    sk_sp<SkSurface>   surf = nullptr)
+    std::vector<Where>          where,
+    const glm::mat3&            matrix,
+    sk_sp<SkPicture>            picture,
+    RasterManager::RasterResult previous = {})
     : RasterTask(index)
     , bgColor(bgColor)
     , matrix(matrix)
@@ -57,37 +117,38 @@ public:
     , tw(tw)
     , th(th)
     , picture(std::move(picture))
-    , surf(std::move(surf))
+    , previous(std::move(previous))
     , mgr(mgr)
   {
   }
 
-  SkColor            bgColor;
-  glm::mat3          matrix;
-  std::vector<Where> damage;
-  int                tw, th;
-  sk_sp<SkPicture>   picture;
-  sk_sp<SkSurface>   surf; // optional, null indicates this is a new surface
-  RasterManager*     mgr;
+  SkColor                     bgColor;
+  glm::mat3                   matrix;
+  std::vector<Where>          damage;
+  int                         tw, th;
+  sk_sp<SkPicture>            picture;
+  RasterManager::RasterResult previous; // optional, its content is kept outside of the damage
+  RasterManager*              mgr;
 
   RasterManager::RasterResult execute(GrRecordingContext* context) override
   {
     using RR = RasterManager::RasterResult;
+    if (isCancelled())
+    {
+      return RR();
+    }
     const int width = tw;
     const int height = th;
-    if (!surf || surf->width() != width || surf->height() != height)
-    {
-      auto rasterSurface = [](GrRecordingContext* context, int w, int h)
+    const bool fullyDamaged = std::any_of(
+      damage.begin(),
+      damage.end(),
+      [&](const Where& b)
       {
-        const auto info = SkImageInfo::MakeN32Premul(w, h);
-        return SkSurfaces::RenderTarget(context, skgpu::Budgeted::kYes, info);
-      };
-
-      surf = rasterSurface(context, width, height);
-      ASSERT(surf);
-      auto canvas = surf->getCanvas();
-      canvas->clear(bgColor);
-    }
+        return b.dst.x <= 0 && b.dst.y <= 0 && b.dst.x + b.src.width() >= width &&
+               b.dst.y + b.src.height() >= height;
+      });
+    auto surf = makeBackSurface(context, width, height, bgColor, previous, fullyDamaged);
+    auto spare = takeSpareSurface(previous, width, height);
 
     auto canvas = surf->getCanvas();
     for (const auto& b : damage)
@@ -101,7 +162,7 @@ public:
       picture->playback(canvas);
       canvas->restore();
     }
-    return RR(mgr, std::move(surf), index());
+    return RR(mgr, std::move(surf), index(), std::move(spare));
   }
 };
 
@@ -121,18 +182,19 @@ public:
   glm::mat3          matrix;
   std::vector<Where> where;
   sk_sp<SkPicture>   picture;
-  sk_sp<SkSurface>   surf; // optional, null indicates a new surface should be created, and the
-                           // surface would be (width, height)
+
+  // optional, its content is kept outside of the damage, the surface would be (width, height)
+  RasterManager::RasterResult previous;
 
   SurfaceTask(
-    int                index,
-    SkColor            bgColor,
-    int                width,
-    int                height,
-    glm::mat3          matrix,
-    std::vector<Where> where,
-    sk_sp<SkPicture>   picture,
-    sk_sp<SkSurface>   surf = nullptr)
+    int                         index,
+    SkColor                     bgColor,
+    int                         width,
+    int                         height,
+    glm::mat3                   matrix,
+    std::vector<Where>          where,
+    sk_sp<SkPicture>            picture,
+    RasterManager::RasterResult previous = {})
     : RasterManager::RasterTask(index)
     , bgColor(bgColor)
     , width(width)
@@ -140,25 +202,14 @@ public:
     , matrix(matrix)
     , where(std::move(where))
     , picture(std::move(picture))
-    , surf(std::move(surf))
+    , previous(std::move(previous))
   {
   }
 
   RasterManager::RasterResult execute(GrRecordingContext* context) override
   {
-    if (!surf || surf->width() != width || surf->height() != height)
-    {
-      auto rasterSurface = [](GrRecordingContext* context, int w, int h)
-      {
-        const auto info = SkImageInfo::MakeN32Premul(w, h);
-        return SkSurfaces::RenderTarget(context, skgpu::Budgeted::kYes, info);
-      };
-
-      surf = rasterSurface(context, width, height);
-      ASSERT(surf);
-      auto canvas = surf->getCanvas();
-      canvas->clear(bgColor);
-    }
+    auto surf = makeBackSurface(context, width, height, bgColor, previous, false);
+    auto spare = takeSpareSurface(previous, width, height);
     ASSERT(surf);
     auto canvas = surf->getCanvas();
 
@@ -173,7 +224,7 @@ public:
       picture->playback(canvas);
       canvas->restore();
     }
-    return RasterManager::RasterResult(nullptr, std::move(surf), index());
+    return RasterManager::RasterResult(nullptr, std::move(surf), index(), std::move(spare));
   }
 };
 
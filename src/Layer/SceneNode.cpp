@@ -22,6 +22,8 @@
 #include <core/SkColor.h>
 #include <core/SkPictureRecorder.h>
 
+#include <unordered_map>
+
 namespace VGG::layer
 {
 
@@ -38,6 +40,15 @@ public:
   FrameArray       frames;
   sk_sp<SkPicture> picture;
 
+  std::unordered_map<int, FrameNode*> frameIndex; // uniqueID -> frame, built on demand
+
+  void invalidateFrameIndex()
+  {
+    frameIndex.clear();
+  }
+
+  // Only the invalid frames are recorded again while revalidating, the scene picture just draws
+  // the pictures of the frames.
   sk_sp<SkPicture> revalidatePicture(const SkRect& bounds)
   {
     SkPictureRecorder rec;
@@ -46,7 +57,10 @@ public:
     Renderer          r = Renderer().createNew(pictureCanvas);
     for (const auto& root : frames)
     {
-      root->render(&r);
+      if (root->isVisible())
+      {
+        root->render(&r);
+      }
     }
     return rec.finishRecordingAsPicture();
   }
@@ -75,6 +89,7 @@ void SceneNode::addFrame(FramePtr frame)
   if (frame)
   {
     d_ptr->frames.push_back(std::move(frame));
+    d_ptr->invalidateFrameIndex();
     observe(d_ptr->frames.back());
     invalidate();
   }
@@ -87,6 +102,7 @@ void SceneNode::setFrames(const std::vector<layer::FramePtr>& frames)
     return;
   }
   d_ptr->frames = frames;
+  d_ptr->invalidateFrameIndex();
   for (auto& frame : d_ptr->frames)
   {
     observe(frame);
@@ -107,6 +123,7 @@ void SceneNode::insertFrame(int index, FramePtr frame)
   {
     return;
   }
+  d_ptr->invalidateFrameIndex();
   if (auto it = d_ptr->frames.insert(d_ptr->frames.begin() + index, frame);
       it != d_ptr->frames.end())
   {
@@ -121,6 +138,7 @@ void SceneNode::eraseFrame(int index)
   {
     return;
   }
+  d_ptr->invalidateFrameIndex();
   if (auto it = d_ptr->frames.erase(d_ptr->frames.begin() + index); it != d_ptr->frames.end())
   {
     unobserve(*it);
@@ -168,7 +186,11 @@ void SceneNode::nodeAt(int x, int y, NodeVisitor visitor, void* userData)
 
 PaintNode* SceneNode::nodeByID(int id)
 {
-  for (auto& root : d_ptr->frames)
+  if (auto frame = frameByID(id))
+  {
+    return frame->node();
+  }
+  for (auto& root : d_ptr->frames) // builds the frames until the node is found
   {
     if (auto node = root->nodeByID(id); node)
       return node;
@@ -176,6 +198,19 @@ PaintNode* SceneNode::nodeByID(int id)
   return nullptr;
 }
 
+FrameNode* SceneNode::frameByID(int id) const
+{
+  auto& index = d_ptr->frameIndex;
+  if (index.empty())
+  {
+    for (auto& root : d_ptr->frames)
+      index.try_emplace(root->uniqueID(), root.get());
+  }
+  if (auto it = index.find(id); it != index.end())
+    return it->second;
+  return nullptr;
+}
+
 Bounds SceneNode::effectBounds() const
 {
   return bounds();
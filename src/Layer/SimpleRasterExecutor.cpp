@@ -24,10 +24,18 @@ RasterManager::RasterResult::Future SimpleRasterExecutor::addRasterTask(
   std::unique_ptr<RasterManager::RasterTask> rasterTask)
 {
   using RR = RasterManager::RasterResult;
-  const auto task =
-    std::make_shared<std::packaged_task<RR()>>([&]() { return rasterTask->execute(context()); });
+  std::shared_ptr<RasterManager::RasterTask> t = std::move(rasterTask);
+  const auto                                 task =
+    std::make_shared<std::packaged_task<RR()>>([t, this]() { return t->execute(context()); });
   add([task]() { (*task)(); });
   return task->get_future();
 }
 
+RasterManager::RasterResult::Future SimpleRasterExecutor::addLowPriorityRasterTask(
+  std::unique_ptr<RasterManager::RasterTask> rasterTask)
+{
+  std::shared_ptr<RasterManager::RasterTask> t = std::move(rasterTask);
+  return std::async(std::launch::deferred, [t, this]() { return t->execute(context()); });
+}
+
 } // namespace VGG::layer
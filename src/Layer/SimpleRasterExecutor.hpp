@@ -32,12 +32,17 @@ public:
   RasterManager::RasterResult::Future addRasterTask(
     std::unique_ptr<RasterManager::RasterTask> rasterTask) override;
 
+  // Low priority tasks are deferred until their results are required, so that they never take
+  // any time of the current frame on the caller thread.
+  RasterManager::RasterResult::Future addLowPriorityRasterTask(
+    std::unique_ptr<RasterManager::RasterTask> rasterTask) override;
+
   void add(Task task) override
   {
     task();
   }
 
-  GrRecordingContext* context()
+  GrRecordingContext* context() override
   {
     return m_context;
   }
@@ -0,0 +1,138 @@
+/*
+ * Copyright 2023-2024 VeryGoodGraphics LTD <bd@verygoodgraphics.com>
+ *
+ * Licensed under the VGG License, Version 1.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.verygoodgraphics.com/licenses/LICENSE-1.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ThreadPoolRasterExecutor.hpp"
+#include "Utility/Log.hpp"
+
+#include <gpu/GrRecordingContext.h>
+
+#include <algorithm>
+
+namespace
+{
+thread_local GrRecordingContext* t_workerContext = nullptr;
+} // namespace
+
+namespace VGG::layer
+{
+
+ThreadPoolRasterExecutor::ThreadPoolRasterExecutor(
+  int            threadCount,
+  ContextFactory factory,
+  Rasterized     rasterized)
+  : m_contextFactory(std::move(factory))
+  , m_rasterized(std::move(rasterized))
+{
+  if (threadCount <= 0)
+  {
+    threadCount = std::max(1, (int)std::thread::hardware_concurrency() - 1);
+  }
+  m_workers.reserve(threadCount);
+  for (int i = 0; i < threadCount; ++i)
+  {
+    m_workers.emplace_back([this, i]() { workerLoop(i); });
+  }
+}
+
+ThreadPoolRasterExecutor::~ThreadPoolRasterExecutor()
+{
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_cond.notify_all();
+  for (auto& worker : m_workers)
+  {
+    if (worker.joinable())
+      worker.join();
+  }
+}
+
+void ThreadPoolRasterExecutor::workerLoop(int index)
+{
+  t_workerContext = m_contextFactory ? m_contextFactory(index) : nullptr;
+  while (true)
+  {
+    Task task;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_cond.wait(
+        lock,
+        [this]() { return m_stop || !m_tasks.empty() || !m_lowPriorityTasks.empty(); });
+      if (m_stop && m_tasks.empty())
+        return; // pending low priority tasks are dropped
+      auto& queue = m_tasks.empty() ? m_lowPriorityTasks : m_tasks;
+      task = std::move(queue.front());
+      queue.pop_front();
+    }
+    task();
+  }
+}
+
+void ThreadPoolRasterExecutor::push(Task task, bool lowPriority)
+{
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    ASSERT(!m_stop);
+    (lowPriority ? m_lowPriorityTasks : m_tasks).push_back(std::move(task));
+  }
+  m_cond.notify_one();
+}
+
+void ThreadPoolRasterExecutor::add(Task task)
+{
+  push(std::move(task), false);
+}
+
+void ThreadPoolRasterExecutor::addLowPriority(Task task)
+{
+  push(std::move(task), true);
+}
+
+RasterManager::RasterResult::Future ThreadPoolRasterExecutor::pushRasterTask(
+  std::unique_ptr<RasterManager::RasterTask> rasterTask,
+  bool                                       lowPriority)
+{
+  using RR = RasterManager::RasterResult;
+  std::shared_ptr<RasterManager::RasterTask> t = std::move(rasterTask);
+  const auto task = std::make_shared<std::packaged_task<RR()>>(
+    [t]() { return t->execute(t_workerContext); });
+  auto future = task->get_future();
+  push(
+    [this, task]()
+    {
+      (*task)();
+      if (m_rasterized)
+      {
+        m_rasterized();
+      }
+    },
+    lowPriority);
+  return future;
+}
+
+RasterManager::RasterResult::Future ThreadPoolRasterExecutor::addRasterTask(
+  std::unique_ptr<RasterManager::RasterTask> rasterTask)
+{
+  return pushRasterTask(std::move(rasterTask), false);
+}
+
+RasterManager::RasterResult::Future ThreadPoolRasterExecutor::addLowPriorityRasterTask(
+  std::unique_ptr<RasterManager::RasterTask> rasterTask)
+{
+  return pushRasterTask(std::move(rasterTask), true);
+}
+
+} // namespace VGG::layer
@@ -0,0 +1,92 @@
+/*
+ * Copyright 2023-2024 VeryGoodGraphics LTD <bd@verygoodgraphics.com>
+ *
+ * Licensed under the VGG License, Version 1.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.verygoodgraphics.com/licenses/LICENSE-1.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include "RasterManager.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace VGG::layer
+{
+
+// Executes raster tasks on a pool of worker threads.
+//
+// By default each worker rasterizes with the cpu backend, so every tile surface is created and
+// painted on the worker thread that executes the task. A context factory could be given to
+// provide a recording context per worker, which is only valid if the contexts are able to share
+// the produced surfaces with the context of the render thread.
+class ThreadPoolRasterExecutor : public RasterManager::RasterExecutor
+{
+public:
+  using ContextFactory = std::function<GrRecordingContext*(int workerIndex)>;
+  using Rasterized = std::function<void()>;
+
+  // threadCount <= 0 means using the hardware concurrency. The rasterized callback is called on the
+  // worker thread after each raster task, e.g. to wake up the render thread to present the result.
+  explicit ThreadPoolRasterExecutor(
+    int            threadCount = 0,
+    ContextFactory factory = nullptr,
+    Rasterized     rasterized = nullptr);
+  ~ThreadPoolRasterExecutor() override;
+
+  RasterManager::RasterResult::Future addRasterTask(
+    std::unique_ptr<RasterManager::RasterTask> rasterTask) override;
+
+  RasterManager::RasterResult::Future addLowPriorityRasterTask(
+    std::unique_ptr<RasterManager::RasterTask> rasterTask) override;
+
+  void add(Task task) override;
+
+  bool isConcurrent() const override
+  {
+    return true;
+  }
+
+  // Low priority tasks are executed only if there is no normal task pending
+  void addLowPriority(Task task);
+
+  int threadCount() const
+  {
+    return (int)m_workers.size();
+  }
+
+private:
+  void workerLoop(int index);
+  void push(Task task, bool lowPriority);
+
+  RasterManager::RasterResult::Future pushRasterTask(
+    std::unique_ptr<RasterManager::RasterTask> rasterTask,
+    bool                                       lowPriority);
+
+  std::vector<std::thread> m_workers;
+  std::deque<Task>         m_tasks;
+  std::deque<Task>         m_lowPriorityTasks;
+  std::mutex               m_mutex;
+  std::condition_variable  m_cond;
+  bool                     m_stop{ false };
+  ContextFactory           m_contextFactory;
+  Rasterized               m_rasterized;
+
+  ThreadPoolRasterExecutor(ThreadPoolRasterExecutor&&) = delete;
+  ThreadPoolRasterExecutor&& operator=(ThreadPoolRasterExecutor&&) = delete;
+};
+
+} // namespace VGG::layer
@@ -0,0 +1,161 @@
+/*
+ * Copyright 2023-2024 VeryGoodGraphics LTD <bd@verygoodgraphics.com>
+ *
+ * Licensed under the VGG License, Version 1.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.verygoodgraphics.com/licenses/LICENSE-1.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "TilePyramid.hpp"
+#include "VSkia.hpp"
+
+#include <core/SkCanvas.h>
+#include <core/SkSamplingOptions.h>
+
+#include <cmath>
+
+namespace VGG::layer
+{
+
+TilePyramid::TilePyramid()
+{
+  RasterCacheBudget::instance().add(this);
+}
+
+TilePyramid::~TilePyramid()
+{
+  RasterCacheBudget::instance().remove(this);
+}
+
+int TilePyramid::zoomLevel(const glm::mat3& rasterMatrix)
+{
+  const auto scale = std::max(std::abs(rasterMatrix[0][0]), 1e-6f);
+  return (int)std::lround(std::log2(scale) * 4);
+}
+
+void TilePyramid::addTile(
+  const glm::mat3&   rasterMatrix,
+  RasterManager::Key key,
+  const Boundsi&     bounds,
+  sk_sp<SkImage>     image)
+{
+  if (!image)
+    return;
+  const auto z = zoomLevel(rasterMatrix);
+  auto&      level = m_levels[z];
+  if (level.rasterMatrix != rasterMatrix)
+  {
+    // Tiles of another raster space in the same quarter octave are replaced, they can't be drawn
+    // with the matrix of this one and their keys might collide.
+    level.tiles.clear();
+    level.bytes = 0;
+    level.rasterMatrix = rasterMatrix;
+  }
+  const auto bytes = image->imageInfo().computeMinByteSize();
+  if (auto it = level.tiles.find(key); it != level.tiles.end())
+  {
+    level.bytes -= it->second.image->imageInfo().computeMinByteSize();
+  }
+  level.tiles[key] = Tile{ bounds, std::move(image) };
+  level.bytes += bytes;
+  m_lastLevel = z;
+  while (m_levels.size() > MAX_LEVEL_COUNT)
+  {
+    removeFarthestLevel(z);
+  }
+}
+
+bool TilePyramid::drawPlaceholder(
+  SkCanvas*        canvas,
+  const glm::mat3& rasterMatrix,
+  const Boundsi&   tileBounds) const
+{
+  ASSERT(canvas);
+  if (m_levels.empty())
+    return false;
+  const auto z = zoomLevel(rasterMatrix);
+  auto       nearest = m_levels.end();
+  for (auto it = m_levels.begin(); it != m_levels.end(); ++it)
+  {
+    if (nearest == m_levels.end() || std::abs(it->first - z) < std::abs(nearest->first - z))
+    {
+      nearest = it;
+    }
+  }
+  const auto& level = nearest->second;
+
+  // current raster space -> level raster space
+  const auto toLevel = level.rasterMatrix * glm::inverse(rasterMatrix);
+  const auto dst = tileBounds.toFloatBounds();
+  const auto src = dst.map(toLevel);
+
+  bool drawn = false;
+  canvas->save();
+  canvas->clipRect(toSkRect(dst));
+  canvas->concat(toSkMatrix(glm::inverse(toLevel)));
+  for (const auto& [k, t] : level.tiles)
+  {
+    if (t.bounds.toFloatBounds().isIntersectWith(src))
+    {
+      canvas->drawImage(
+        t.image,
+        t.bounds.x(),
+        t.bounds.y(),
+        SkSamplingOptions(SkFilterMode::kLinear));
+      drawn = true;
+    }
+  }
+  canvas->restore();
+  return drawn;
+}
+
+void TilePyramid::clear()
+{
+  m_levels.clear();
+}
+
+size_t TilePyramid::cachedBytes() const
+{
+  size_t bytes = 0;
+  for (const auto& [z, level] : m_levels)
+  {
+    bytes += level.bytes;
+  }
+  return bytes;
+}
+
+size_t TilePyramid::evictBytes(size_t bytes)
+{
+  size_t released = 0;
+  while (released < bytes && !m_levels.empty())
+  {
+    released += cachedBytes();
+    removeFarthestLevel(m_lastLevel);
+    released -= cachedBytes();
+  }
+  return released;
+}
+
+void TilePyramid::removeFarthestLevel(int zoomLevel)
+{
+  // levels are ordered, the farthest one is either the first or the last
+  auto first = m_levels.begin();
+  auto last = std::prev(m_levels.end());
+  if (std::abs(first->first - zoomLevel) >= std::abs(last->first - zoomLevel))
+  {
+    m_levels.erase(first);
+  }
+  else
+  {
+    m_levels.erase(last);
+  }
+}
+
+} // namespace VGG::layer
@@ -0,0 +1,90 @@
+/*
+ * Copyright 2023-2024 VeryGoodGraphics LTD <bd@verygoodgraphics.com>
+ *
+ * Licensed under the VGG License, Version 1.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.verygoodgraphics.com/licenses/LICENSE-1.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include "RasterCacheBudget.hpp"
+#include "RasterManager.hpp"
+#include "Layer/Core/VBounds.hpp"
+
+#include <core/SkImage.h>
+#include <core/SkRefCnt.h>
+
+#include <map>
+#include <unordered_map>
+
+class SkCanvas;
+
+namespace VGG::layer
+{
+
+// Tiles rasterized at previous zoom levels, keyed by (zoom level, tile key).
+//
+// While tiles of the current scale are being rasterized, tiles of the nearest level are drawn
+// scaled as placeholders. A zoom level is a quarter octave of the raster scale, it only holds the
+// tiles of the raster matrix it was last added with.
+class TilePyramid : public RasterCacheBudget::Client
+{
+public:
+  struct Tile
+  {
+    Boundsi        bounds; // in the raster space of the level
+    sk_sp<SkImage> image;
+  };
+
+  TilePyramid();
+  ~TilePyramid() override;
+
+  TilePyramid(const TilePyramid&) = delete;
+  TilePyramid& operator=(const TilePyramid&) = delete;
+
+  static int zoomLevel(const glm::mat3& rasterMatrix);
+
+  void addTile(
+    const glm::mat3&   rasterMatrix,
+    RasterManager::Key key,
+    const Boundsi&     bounds,
+    sk_sp<SkImage>     image);
+
+  // Draws the tiles of the nearest level covering the given tile of the given raster space.
+  // Returns false if there is nothing to draw.
+  bool drawPlaceholder(SkCanvas* canvas, const glm::mat3& rasterMatrix, const Boundsi& tileBounds)
+    const;
+
+  bool empty() const
+  {
+    return m_levels.empty();
+  }
+
+  void clear();
+
+  size_t cachedBytes() const override;
+  size_t evictBytes(size_t bytes) override;
+
+private:
+  struct Level
+  {
+    glm::mat3                                    rasterMatrix{ 1.0 };
+    std::unordered_map<RasterManager::Key, Tile> tiles;
+    size_t                                       bytes{ 0 };
+  };
+
+  void removeFarthestLevel(int zoomLevel);
+
+  static constexpr int MAX_LEVEL_COUNT = 4;
+  std::map<int, Level> m_levels;
+  int                  m_lastLevel{ 0 };
+};
+
+} // namespace VGG::layer
@@ -16,7 +16,9 @@
 #include <algorithm>
 #include <core/SkColor.h>
 // #include <format>
+#include <functional>
 #include <iterator>
+#include <mutex>
 #include <ostream>
 #include <sstream>
 
@@ -35,6 +37,8 @@
 #include "Layer/Core/ViewportNode.hpp"
 #include "Layer/Graphics/VSkiaGL.hpp" // this header and the skia headers must be included first for ios build
 #include "Layer/SimpleRasterExecutor.hpp"
+#include "Layer/ThreadPoolRasterExecutor.hpp"
+#include "Layer/GlobalSettings.hpp"
 
 #ifdef VGG_USE_VULKAN
 #include "Layer/Graphics/VSkiaVK.hpp"
@@ -172,8 +176,15 @@ public:
 
   std::vector<std::shared_ptr<Renderable>> items;
 
-  Ref<Viewport>   viewport;
-  Ref<RasterNode> rasterNode;
+  Ref<Viewport> viewport;
+
+  // called by the raster threads, so it must outlive the executor
+  std::mutex            wakeUpMutex;
+  std::function<void()> wakeUp;
+
+  // must be declared before the raster node, which refers to it
+  std::unique_ptr<RasterManager::RasterExecutor> rasterExecutor;
+  Ref<RasterNode>                                rasterNode;
 
   bool invalid{ true };
 
@@ -311,6 +322,23 @@ bool VLayer::debugModeEnabled()
   return d_ptr->debugConfig.debugMode;
 }
 
+bool VLayer::hasPendingTiles() const
+{
+  return d_ptr->rasterNode && d_ptr->rasterNode->hasPendingTiles();
+}
+
+void VLayer::setWakeUp(std::function<void()> wakeUp)
+{
+  std::lock_guard<std::mutex> lock(d_ptr->wakeUpMutex);
+  d_ptr->wakeUp = std::move(wakeUp);
+}
+
+bool VLayer::wakesUpOnRasterized() const
+{
+  std::lock_guard<std::mutex> lock(d_ptr->wakeUpMutex);
+  return d_ptr->wakeUp && d_ptr->rasterExecutor && d_ptr->rasterExecutor->isConcurrent();
+}
+
 void VLayer::setScaleFactor(float scale)
 {
   d_ptr->viewport->setScale(scale);
@@ -398,45 +426,54 @@ void VLayer::setRenderNode(Ref<RenderNode> node)
 
 void VLayer::setRenderNode(Ref<ZoomerNode> transform, Ref<RenderNode> node)
 {
-  static SimpleRasterExecutor s_e(d_ptr->skiaContext->context());
-  d_ptr->rasterNode = raster::make(&s_e, d_ptr->viewport, std::move(transform), std::move(node));
+  VGG_IMPL(VLayer);
+  _->rasterNode = nullptr;
+  if (const auto n = rasterThreadCount(); n > 0)
+  {
+    _->rasterExecutor = std::make_unique<ThreadPoolRasterExecutor>(
+      n,
+      nullptr,
+      [_]()
+      {
+        std::lock_guard<std::mutex> lock(_->wakeUpMutex);
+        if (_->wakeUp)
+        {
+          _->wakeUp();
+        }
+      });
+  }
+  else
+  {
+    _->rasterExecutor = std::make_unique<SimpleRasterExecutor>(_->skiaContext->context());
+  }
+  _->rasterNode =
+    raster::make(_->rasterExecutor.get(), _->viewport, std::move(transform), std::move(node));
 }
 
 } // namespace VGG::layer
 
-namespace
-{
-PaintNode* g_nodeAtResult = nullptr;
-}; // namespace
-
 PaintNode* VLayer::nodeAt(int x, int y)
 {
   if (d_ptr->rasterNode)
   {
-    auto p = glm::vec3{ x, y, 1 };
-    g_nodeAtResult = nullptr;
+    auto       p = glm::vec3{ x, y, 1 };
+    PaintNode* result = nullptr;
     d_ptr->rasterNode->nodeAt(
       p.x,
       p.y,
       [](RenderNode* node, const RenderNode::NodeAtContext* ctx)
       {
+        auto result = static_cast<PaintNode**>(ctx->userData);
+        if (*result) // the front frame has been hit
+          return;
         auto frameNode = static_cast<FrameNode*>(node);
-        auto paintNode = frameNode->node();
-        paintNode->nodeAt(
-          ctx->localX,
-          ctx->localY,
-          [](PaintNode* p, const PaintNode::NodeAtContext* ctx)
-          {
-            if (!g_nodeAtResult)
-              g_nodeAtResult = p;
-          },
-          nullptr);
+        *result = frameNode->node()->nodeAt(ctx->localX, ctx->localY);
       },
-      nullptr);
-    VGG_LAYER_DEBUG_CODE(if (g_nodeAtResult && d_ptr->debugConfig.enableDrawClickBounds) {
-      drawBounds(g_nodeAtResult, glm::mat3{ 1 }, d_ptr->layerCanvas());
+      &result);
+    VGG_LAYER_DEBUG_CODE(if (result && d_ptr->debugConfig.enableDrawClickBounds) {
+      drawBounds(result, glm::mat3{ 1 }, d_ptr->layerCanvas());
     });
-    return g_nodeAtResult;
+    return result;
   }
   return nullptr;
 }
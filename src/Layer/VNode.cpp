@@ -27,8 +27,20 @@ void Revalidation::emit(const Bounds& bounds, const glm::mat3& ctm, VNode* node)
     return;
   }
   const auto mappedBounds = bounds.map(ctm);
-  m_boundsArray.push_back(mappedBounds);
   m_bounds.unionWith(mappedBounds);
+
+  // A node is often damaged by several changes, the covered bounds are not emitted twice
+  const auto covers = [](const Bounds& outer, const Bounds& inner)
+  { return outer.unionAs(inner) == outer; };
+  for (const auto& b : m_boundsArray)
+  {
+    if (covers(b, mappedBounds))
+    {
+      return;
+    }
+  }
+  std::erase_if(m_boundsArray, [&](const Bounds& b) { return covers(mappedBounds, b); });
+  m_boundsArray.push_back(mappedBounds);
 }
 
 class VNode::ScopedState
@@ -29,11 +29,13 @@
 #include <private/base/SkFixed.h>
 #include <src/core/SkFontDescriptor.h>
 #include <rapidfuzz/fuzz.hpp>
+#include <nlohmann/json.hpp>
 
 #include <limits>
 #include <memory>
 #include <optional>
 #include <iostream>
+#include <unordered_set>
 #include <src/ports/SkFontHost_FreeType_common.h>
 
 #include "Utility/Log.hpp"
@@ -366,6 +368,73 @@ sk_sp<SkTypeface> SkFontMgrVGG::onLegacyMakeTypeface(const char familyName[], Sk
   return tf;
 }
 
+bool FontIndex::load(const fs::path& path)
+{
+  std::ifstream ifs(path);
+  if (!ifs.is_open())
+  {
+    return false;
+  }
+
+  try
+  {
+    const auto j = nlohmann::json::parse(ifs);
+    if (j.value("version", 0) != VERSION)
+    {
+      return false;
+    }
+    for (const auto& f : j.at("files"))
+    {
+      File file{ f.at("mtime").get<std::int64_t>(), f.at("size").get<std::uintmax_t>(), {} };
+      for (const auto& face : f.at("faces"))
+      {
+        file.faces.push_back({ face.at("index").get<int>(),
+                               face.at("family").get<std::string>(),
+                               face.at("weight").get<int>(),
+                               face.at("width").get<int>(),
+                               face.at("slant").get<int>(),
+                               face.at("fixedPitch").get<bool>() });
+      }
+      files[f.at("path").get<std::string>()] = std::move(file);
+    }
+    return true;
+  }
+  catch (const nlohmann::json::exception& e)
+  {
+    WARN("Invalid font index: %s, %s", path.string().c_str(), e.what());
+    files.clear();
+    return false;
+  }
+}
+
+void FontIndex::save(const fs::path& path) const
+{
+  auto fileArray = nlohmann::json::array();
+  for (const auto& [filename, file] : files)
+  {
+    auto faces = nlohmann::json::array();
+    for (const auto& face : file.faces)
+    {
+      faces.push_back({ { "index", face.index },
+                        { "family", face.family },
+                        { "weight", face.weight },
+                        { "width", face.width },
+                        { "slant", face.slant },
+                        { "fixedPitch", face.fixedPitch } });
+    }
+    fileArray.push_back(
+      { { "path", filename }, { "mtime", file.mtime }, { "size", file.size }, { "faces", faces } });
+  }
+
+  std::ofstream ofs(path);
+  if (!ofs.is_open())
+  {
+    WARN("Failed to write font index: %s", path.string().c_str());
+    return;
+  }
+  ofs << nlohmann::json{ { "version", VERSION }, { "files", std::move(fileArray) } };
+}
+
 bool VGGFontLoader::appendTypeface(
   const SkTypeface_FreeType::Scanner& scanner,
   SkStreamAsset*                      stream,
@@ -387,14 +456,8 @@ bool VGGFontLoader::appendTypeface(
     SkFontStyle style = SkFontStyle(); // avoid uninitialized warning
     if (scanner.scanFont(stream, faceIndex, &realname, &style, &isFixedPitch, nullptr))
     {
-      SkFontStyleSet_VGG* addTo = find_family(*families, realname.c_str());
-      if (nullptr == addTo)
-      {
-        addTo = new SkFontStyleSet_VGG(realname);
-        families->push_back().reset(addTo);
-        families->lookUp[realname.c_str()] = families->size() - 1;
-      }
-      auto typeface = creator(faceIndex, style, realname, isFixedPitch);
+      SkFontStyleSet_VGG* addTo = add_family(*families, realname);
+      auto                typeface = creator(faceIndex, style, realname, isFixedPitch);
       if (typeface)
       {
         addTo->appendTypeface(std::move(typeface));
@@ -428,12 +491,50 @@ bool VGGFontLoader::loadFontFromData(
   return true;
 }
 
+std::optional<std::vector<FontIndex::Face>> VGGFontLoader::scanFile(
+  const SkTypeface_FreeType::Scanner& scanner,
+  const std::string&                  filename)
+{
+  std::unique_ptr<SkStreamAsset> stream = SkStream::MakeFromFile(filename.c_str());
+  if (!stream)
+  {
+    return std::nullopt;
+  }
+
+  std::vector<FontIndex::Face> faces;
+  int                          numFaces;
+  if (!scanner.recognizedFont(stream.get(), &numFaces))
+  {
+    return faces; // indexed without faces, so it's not scanned again
+  }
+
+  for (int faceIndex = 0; faceIndex < numFaces; ++faceIndex)
+  {
+    bool        isFixedPitch;
+    SkString    realname;
+    SkFontStyle style = SkFontStyle(); // avoid uninitialized warning
+    if (scanner.scanFont(stream.get(), faceIndex, &realname, &style, &isFixedPitch, nullptr))
+    {
+      faces.push_back({ faceIndex,
+                        realname.c_str(),
+                        style.weight(),
+                        style.width(),
+                        style.slant(),
+                        isFixedPitch });
+    }
+  }
+  return faces;
+}
+
 void VGGFontLoader::loadDirectoryFonts(
   const SkTypeface_FreeType::Scanner& scanner,
   const SkString&                     directory,
-  const char*                         suffix,
+  const FontIndex&                    cached,
+  FontIndex&                          index,
   SkFontMgrVGG::Families*             families)
 {
+  static const std::unordered_set<std::string> SUFFIXES{ ".ttf", ".ttc", ".otf", ".pfb" };
+
   const std::filesystem::path dir{ directory.c_str() };
 
   if (!(fs::exists(dir) && fs::is_directory(dir)))
@@ -444,46 +545,52 @@ void VGGFontLoader::loadDirectoryFonts(
 
   try
   {
+    // the iterator walks into the subdirectories, every file is visited once
     for (auto const& entry : fs::recursive_directory_iterator(dir))
     {
       if (!entry.is_regular_file())
       {
         continue;
       }
-      if (entry.path().extension() != suffix)
+      if (SUFFIXES.find(entry.path().extension().string()) == SUFFIXES.end())
         continue;
-      auto                           filename = entry.path().string();
-      std::unique_ptr<SkStreamAsset> stream = SkStream::MakeFromFile(filename.c_str());
-      if (!stream)
+      auto filename = entry.path().string();
+      if (index.files.find(filename) != index.files.end())
       {
-        continue;
+        continue; // in the overlapping directories
       }
-      appendTypeface(
-        scanner,
-        stream.get(),
-        families,
-        [&](int index, const SkFontStyle& style, const SkString& familyName, bool isFixedPitch)
-          -> sk_sp<SkTypeface>
-        {
-          return sk_make_sp<SkTypeface_VGG_File>(
-            style,
-            isFixedPitch,
-            true,
-            familyName,
-            filename.c_str(),
-            index);
-        });
-    }
 
-    for (auto const& entry : fs::recursive_directory_iterator(dir))
-    {
-      if (!entry.is_directory())
+      const auto      mtime = entry.last_write_time().time_since_epoch().count();
+      FontIndex::File file{ static_cast<std::int64_t>(mtime), entry.file_size(), {} };
+      if (auto it = cached.files.find(filename);
+          it != cached.files.end() && it->second.mtime == file.mtime &&
+          it->second.size == file.size)
+      {
+        file.faces = it->second.faces;
+      }
+      else if (auto faces = scanFile(scanner, filename))
+      {
+        file.faces = std::move(*faces);
+      }
+      else
       {
         continue;
       }
 
-      auto dirName = entry.path().string();
-      loadDirectoryFonts(scanner, SkString{ dirName }, suffix, families);
+      // the file is opened when the typeface is used
+      for (const auto& face : file.faces)
+      {
+        const SkString familyName{ face.family.c_str() };
+        add_family(*families, familyName)
+          ->appendTypeface(sk_make_sp<SkTypeface_VGG_File>(
+            SkFontStyle(face.weight, face.width, static_cast<SkFontStyle::Slant>(face.slant)),
+            face.fixedPitch,
+            true,
+            familyName,
+            filename.c_str(),
+            face.index));
+      }
+      index.files[filename] = std::move(file);
     }
   }
   catch (...)
@@ -497,6 +604,13 @@ void VGGFontLoader::loadSystemFonts(
   const SkTypeface_FreeType::Scanner& scanner,
   SkFontMgrVGG::Families*             families) const
 {
+  FontIndex cached;
+  if (!m_indexFile.empty())
+  {
+    cached.load(m_indexFile);
+  }
+  FontIndex index;
+
   // helper type for the visitor #4
   using namespace VGG::layer;
   std::visit(
@@ -504,10 +618,7 @@ void VGGFontLoader::loadSystemFonts(
                 {
                   if (arg.isEmpty() == false)
                   {
-                    loadDirectoryFonts(scanner, arg, ".ttf", families);
-                    loadDirectoryFonts(scanner, arg, ".ttc", families);
-                    loadDirectoryFonts(scanner, arg, ".otf", families);
-                    loadDirectoryFonts(scanner, arg, ".pfb", families);
+                    loadDirectoryFonts(scanner, arg, cached, index, families);
                   }
                 },
                 [&](const std::vector<fs::path>& arg)
@@ -517,14 +628,16 @@ void VGGFontLoader::loadSystemFonts(
                     SkString path(p.string());
                     if (path.isEmpty() == false)
                     {
-                      loadDirectoryFonts(scanner, path, ".ttf", families);
-                      loadDirectoryFonts(scanner, path, ".ttc", families);
-                      loadDirectoryFonts(scanner, path, ".otf", families);
-                      loadDirectoryFonts(scanner, path, ".pfb", families);
+                      loadDirectoryFonts(scanner, path, cached, index, families);
                     }
                   }
                 } },
     this->dir);
+  if (!m_indexFile.empty() && !(index == cached))
+  {
+    index.save(m_indexFile);
+  }
+
   if (families->empty())
   {
     SkFontStyleSet_VGG* family = new SkFontStyleSet_VGG(SkString());
@@ -31,6 +31,7 @@
 #include <modules/skparagraph/include/FontCollection.h>
 #include <modules/skparagraph/include/TypefaceFontProvider.h>
 
+#include <cstdint>
 #include <optional>
 #include <unordered_map>
 #include <map>
@@ -263,6 +264,43 @@ private:
   SkTypeface_FreeType::Scanner fScanner;
 };
 
+/**
+ *  FontIndex
+ *
+ *  The faces scanned from the font files of the directories, persisted so that a file is only
+ *  opened and scanned again when its modification time or size is changed.
+ */
+struct FontIndex
+{
+  static constexpr int VERSION = 1;
+
+  struct Face
+  {
+    int         index;
+    std::string family;
+    int         weight;
+    int         width;
+    int         slant;
+    bool        fixedPitch;
+
+    bool operator==(const Face&) const = default;
+  };
+  struct File
+  {
+    std::int64_t      mtime;
+    std::uintmax_t    size;
+    std::vector<Face> faces;
+
+    bool operator==(const File&) const = default;
+  };
+  std::unordered_map<std::string, File> files; // by path
+
+  bool operator==(const FontIndex&) const = default;
+
+  bool load(const fs::path& path);
+  void save(const fs::path& path) const;
+};
+
 class VGGFontLoader : public SkFontMgrVGG::SystemFontLoader
 {
 public:
@@ -271,8 +309,9 @@ public:
   {
   }
 
-  VGGFontLoader(const std::vector<fs::path>& paths)
+  VGGFontLoader(const std::vector<fs::path>& paths, fs::path indexFile = {})
     : dir(paths)
+    , m_indexFile(std::move(indexFile))
   {
   }
 
@@ -293,10 +332,13 @@ public:
     SkFontMgrVGG::Families*             families,
     const char*                         defaultRealName);
 
+  // Walks the directory and its subdirectories once, the files in the cached index which are not
+  // changed are not opened. The loaded files are added to the index.
   static void loadDirectoryFonts(
     const SkTypeface_FreeType::Scanner& scanner,
     const SkString&                     directory,
-    const char*                         suffix,
+    const FontIndex&                    cached,
+    FontIndex&                          index,
     SkFontMgrVGG::Families*             families);
 
 private:
@@ -309,6 +351,22 @@ private:
     return nullptr;
   }
 
+  static SkFontStyleSet_VGG* add_family(SkFontMgrVGG::Families& families, const SkString& name)
+  {
+    SkFontStyleSet_VGG* addTo = find_family(families, name.c_str());
+    if (nullptr == addTo)
+    {
+      addTo = new SkFontStyleSet_VGG(name);
+      families.push_back().reset(addTo);
+      families.lookUp[name.c_str()] = families.size() - 1;
+    }
+    return addTo;
+  }
+
+  static std::optional<std::vector<FontIndex::Face>> scanFile(
+    const SkTypeface_FreeType::Scanner& scanner,
+    const std::string&                  filename);
+
   static bool appendTypeface(
     const SkTypeface_FreeType::Scanner& scanner,
     SkStreamAsset*                      stream,
@@ -316,6 +374,7 @@ private:
     TypefaceCreator                     creator);
 
   std::variant<SkString, std::vector<fs::path>> dir;
+  fs::path                                      m_indexFile; // no index if empty
 };
 
 inline SK_API sk_sp<SkFontMgrVGG> VGGFontDirectory(const char* dir)
@@ -323,9 +382,11 @@ inline SK_API sk_sp<SkFontMgrVGG> VGGFontDirectory(const char* dir)
   return sk_make_sp<SkFontMgrVGG>(std::make_unique<VGGFontLoader>(dir));
 }
 
-inline SK_API sk_sp<SkFontMgrVGG> VGGFontDirectory(const std::vector<fs::path>& dir)
+inline SK_API sk_sp<SkFontMgrVGG> VGGFontDirectory(
+  const std::vector<fs::path>& dir,
+  fs::path                     indexFile = {})
 {
-  return sk_make_sp<SkFontMgrVGG>(std::make_unique<VGGFontLoader>(dir));
+  return sk_make_sp<SkFontMgrVGG>(std::make_unique<VGGFontLoader>(dir, std::move(indexFile)));
 }
 
 class VGGFontCollection : public skia::textlayout::FontCollection
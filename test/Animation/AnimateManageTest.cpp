@@ -0,0 +1,121 @@
+/*
+ * Copyright 2023-2024 VeryGoodGraphics LTD <bd@verygoodgraphics.com>
+ *
+ * Licensed under the VGG License, Version 1.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.verygoodgraphics.com/licenses/LICENSE-1.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Application/Animate.hpp"
+
+#include <gtest/gtest.h>
+
+namespace VGG::test::animation
+{
+
+namespace
+{
+constexpr auto DURATION = milliseconds(100);
+
+class ProgressAnimate : public Animate
+{
+public:
+  ProgressAnimate()
+    : Animate(DURATION, milliseconds(16), std::make_shared<LinearInterpolator>())
+  {
+  }
+
+  using Animate::start;
+
+  void timerCallback() override
+  {
+    Animate::timerCallback();
+    progress = (*getInterpolator())(getPassedTime(), 0, 1, getDuration());
+    ++triggeredCount;
+  }
+
+  double progress{ 0 };
+  int    triggeredCount{ 0 };
+};
+
+std::shared_ptr<ProgressAnimate> startAnimate(AnimateManage& manage)
+{
+  auto animate = std::make_shared<ProgressAnimate>();
+  animate->start();
+  manage.addAnimate(animate);
+  return animate;
+}
+} // namespace
+
+TEST(AnimateManageTest, ProgressFollowsTheElapsedTime)
+{
+  const auto    t0 = steady_clock::time_point{} + std::chrono::seconds(1);
+  AnimateManage manage;
+  auto          animate = startAnimate(manage);
+
+  manage.advance(t0);
+  EXPECT_DOUBLE_EQ(animate->progress, 0);
+
+  manage.advance(t0 + milliseconds(25));
+  EXPECT_DOUBLE_EQ(animate->progress, 0.25);
+
+  manage.advance(t0 + milliseconds(60));
+  EXPECT_DOUBLE_EQ(animate->progress, 0.6);
+  EXPECT_FALSE(animate->isFinished());
+}
+
+TEST(AnimateManageTest, ProgressDoesNotDependOnTheAdvanceCount)
+{
+  const auto    t0 = steady_clock::time_point{} + std::chrono::seconds(1);
+  AnimateManage slowFrames;
+  AnimateManage fastFrames;
+  auto          slow = startAnimate(slowFrames);
+  auto          fast = startAnimate(fastFrames);
+
+  slowFrames.advance(t0);
+  slowFrames.advance(t0 + milliseconds(50));
+
+  for (int i = 0; i <= 50; i += 5)
+  {
+    fastFrames.advance(t0 + milliseconds(i));
+  }
+
+  EXPECT_EQ(slow->triggeredCount, 2);
+  EXPECT_EQ(fast->triggeredCount, 11);
+  EXPECT_DOUBLE_EQ(slow->progress, 0.5);
+  EXPECT_DOUBLE_EQ(fast->progress, slow->progress);
+}
+
+TEST(AnimateManageTest, FinishesAfterTheDuration)
+{
+  const auto    t0 = steady_clock::time_point{} + std::chrono::seconds(1);
+  AnimateManage manage;
+  auto          animate = startAnimate(manage);
+
+  manage.advance(t0);
+  manage.advance(t0 + DURATION - milliseconds(1));
+  EXPECT_FALSE(animate->isFinished());
+  EXPECT_FALSE(manage.deleteFinishedAnimate());
+  EXPECT_TRUE(manage.hasRunningAnimation());
+
+  manage.advance(t0 + DURATION);
+  EXPECT_DOUBLE_EQ(animate->progress, 1);
+  EXPECT_TRUE(animate->isFinished());
+
+  const auto triggeredCount = animate->triggeredCount;
+  manage.advance(t0 + DURATION + milliseconds(16));
+  EXPECT_EQ(animate->triggeredCount, triggeredCount); // a finished animation is not advanced
+
+  EXPECT_TRUE(manage.deleteFinishedAnimate());
+  EXPECT_FALSE(manage.hasRunningAnimation());
+}
+
+} // namespace VGG::test::animation
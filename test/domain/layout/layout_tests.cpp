@@ -1,6 +1,8 @@
 #include "base.hpp"
 
+#include "Domain/Layout/HitTestIndex.hpp"
 #include "Domain/Layout/Layout.hpp"
+#include "Domain/Model/DesignDocAdapter.hpp"
 #include "Domain/Model/Element.hpp"
 #include "UseCase/StartRunning.hpp"
 
@@ -10,6 +12,8 @@
 
 #include <gtest/gtest.h>
 
+#include <functional>
+
 using namespace VGG;
 
 class VggLayoutTestSuite : public BaseVggLayoutTestSuite
@@ -272,4 +276,79 @@ TEST_F(VggLayoutTestSuite, Fill_width_item_in_fixed_width_container)
   std::vector<Layout::Rect> expectedFrames{ { { 260, 0 }, { 1400, 101 } } };
 
   EXPECT_TRUE(descendantFrame({ 0 }, 0) == expectedFrames[0]);
-}
\ No newline at end of file
+}
+TEST_F(VggLayoutTestSuite, Hit_test_index)
+{
+  setupWithExpanding("testDataDir/layout/11_first_on_top/");
+  layout(Layout::Size{ 1920, 1080 });
+  auto page = firstPage();
+
+  HitTestIndex sut;
+  const auto   bounds = page->frameToAncestor();
+  for (auto x = bounds.origin.x; x <= bounds.origin.x + bounds.size.width; x += 10)
+  {
+    for (auto y = bounds.origin.y; y <= bounds.origin.y + bounds.size.height; y += 10)
+    {
+      const Layout::Point p{ x, y };
+      const auto          expected = page->hitTest(p, nullptr);
+      const auto          target = sut.hitTest(*page, p, nullptr);
+      EXPECT_EQ(target.first, expected.first);
+      if (target.first)
+      {
+        EXPECT_EQ(
+          sut.hitTest(*page, p, nullptr, target.first.get()).first,
+          target.first->hitTest(p, nullptr).first);
+      }
+    }
+  }
+  EXPECT_EQ(sut.size(), page->treeSize());
+  EXPECT_TRUE(sut.isValid(page.get()));
+
+  sut.invalidate();
+  EXPECT_FALSE(sut.isValid(page.get()));
+}
+
+TEST_F(VggLayoutTestSuite, Find_nodes_and_elements_by_id)
+{
+  setupWithExpanding("testDataDir/layout/3_flex_with_symbol_instance/");
+  auto tree = m_sut->layoutTree();
+  auto doc = m_sut->designDocTree();
+
+  std::function<void(const std::shared_ptr<LayoutNode>&)> check =
+    [&](const std::shared_ptr<LayoutNode>& node)
+  {
+    if (const auto& id = node->id(); !id.empty())
+    {
+      EXPECT_EQ(m_sut->findNodeById(id), tree->findDescendantNodeById(id));
+      EXPECT_EQ(m_sut->findNodeById(id), m_sut->findNodeById(id)); // cached
+      auto element = doc->getElementByKey(id);
+      ASSERT_TRUE(element);
+      EXPECT_TRUE(element->id() == id || element->name() == id);
+    }
+    for (const auto& child : node->children())
+      check(child);
+  };
+  check(tree);
+
+  // the index follows the changes of the tree
+  auto page = doc->children()[0];
+  auto frame = std::make_shared<Domain::FrameElement>(Model::Frame{});
+  frame->addKeyPrefix("new_frame_id");
+  EXPECT_FALSE(doc->getElementByKey("new_frame_id"));
+  page->addChild(frame);
+  EXPECT_EQ(doc->getElementByKey("new_frame_id"), frame);
+}
+
+TEST_F(VggLayoutTestSuite, Value_at_pointer)
+{
+  setupWithExpanding("testDataDir/layout/3_flex_with_symbol_instance/");
+  Model::DesignDocAdapter sut{ m_sut->designDocTree() };
+  const auto              content = sut.content();
+
+  for (const auto& path : { "", "/frames/0", "/frames/0/childObjects/0", "/frames/0/name" })
+  {
+    nlohmann::json::json_pointer pointer{ path };
+    EXPECT_EQ(sut.valueAt(pointer), content.at(pointer));
+  }
+  EXPECT_ANY_THROW(sut.valueAt(nlohmann::json::json_pointer{ "/frames/100" }));
+}
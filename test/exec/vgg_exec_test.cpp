@@ -49,4 +49,25 @@ TEST_F(VggExecTestSuite, Smoke)
   result = sut.evalScript("1");
   // Then
   EXPECT_EQ(result, false);
-}
\ No newline at end of file
+}
+
+TEST_F(VggExecTestSuite, Dispatch_event_without_engine_support)
+{
+  // Given
+  auto mock_js_engine = new VggJSEngineMock();
+
+  std::shared_ptr<IVggEnv>     env_ptr{ new VggEnv() };
+  std::shared_ptr<VggJSEngine> js_ptr{ mock_js_engine };
+
+  VggExec sut(js_ptr, env_ptr);
+
+  // the mock engine has no dispatch support, the listener is called by a script
+  EXPECT_CALL(*mock_js_engine, evalScript(_)).WillOnce(Return(true)); // setEnv
+  EXPECT_CALL(*mock_js_engine, evalModule(_)).WillOnce(Return(true));
+
+  // When
+  auto result = sut.dispatchEvent(R"({"type":"click"})");
+
+  // Then
+  EXPECT_EQ(result, true);
+}
@@ -0,0 +1,69 @@
+#include "Layer/DamageRegion.hpp"
+#include "Layer/Core/RasterNode.hpp"
+
+#include <gtest/gtest.h>
+#include <algorithm>
+
+using namespace VGG::layer;
+
+TEST(DamageRegionTest, KeepDistantDamagesApart)
+{
+  // a blinking cursor at the top left and a hover at the bottom right
+  const auto merged = mergeBounds({ Bounds(10, 10, 2, 20), Bounds(900, 700, 100, 40) });
+  ASSERT_EQ(merged.size(), 2u);
+  EXPECT_EQ(merged[0], Bounds(10, 10, 2, 20));
+  EXPECT_EQ(merged[1], Bounds(900, 700, 100, 40));
+}
+
+TEST(DamageRegionTest, MergeCoveredAndAdjacentDamages)
+{
+  DamageRegion region;
+  region.add(Bounds(0, 0, 100, 100));
+  region.add(Bounds(10, 10, 20, 20));  // covered
+  region.add(Bounds(100, 0, 50, 100)); // adjacent, the union wastes nothing
+  ASSERT_EQ(region.rects().size(), 1u);
+  EXPECT_EQ(region.rects()[0], Bounds(0, 0, 150, 100));
+
+  region.add(Bounds(0, 0, 200, 200)); // covers everything
+  ASSERT_EQ(region.rects().size(), 1u);
+  EXPECT_EQ(region.rects()[0], Bounds(0, 0, 200, 200));
+}
+
+TEST(DamageRegionTest, BoundRectCount)
+{
+  DamageRegion region(3);
+  for (int i = 0; i < 10; i++)
+  {
+    region.add(Bounds(i * 100, 0, 10, 10));
+  }
+  EXPECT_EQ(region.rects().size(), 3u);
+  EXPECT_DOUBLE_EQ(region.damagedArea(), 1000);
+  EXPECT_GT(region.area(), region.damagedArea());
+
+  // every damage is still covered
+  for (int i = 0; i < 10; i++)
+  {
+    const auto damage = Bounds(i * 100, 0, 10, 10);
+    EXPECT_TRUE(std::any_of(
+      region.rects().begin(),
+      region.rects().end(),
+      [&](const Bounds& r) { return r.unionAs(damage) == r; }));
+  }
+}
+
+TEST(DamageRegionTest, SnapToGrid)
+{
+  DamageRegion region;
+  region.setGrid(Bounds(256, 0, 256, 256), 32, 32);
+  region.add(Bounds(250.5f, 40.25f, 20, 10)); // crosses the left edge of the tile
+  ASSERT_EQ(region.rects().size(), 1u);
+  EXPECT_EQ(region.rects()[0], Bounds(256, 32, 32, 32));
+  EXPECT_DOUBLE_EQ(region.damagedArea(), 14.5 * 10);
+
+  region.add(Bounds(300, 300, 10, 10)); // outside of the tile
+  EXPECT_EQ(region.rects().size(), 1u);
+
+  region.add(Bounds(500, 250, 100, 100)); // clamped to the tile
+  ASSERT_EQ(region.rects().size(), 2u);
+  EXPECT_EQ(region.rects()[1], Bounds(480, 224, 32, 32));
+}
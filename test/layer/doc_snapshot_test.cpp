@@ -0,0 +1,61 @@
+#include "Layer/DocSnapshot.hpp"
+
+#include "Domain/Layout/ExpandSymbol.hpp"
+#include "Domain/Layout/Layout.hpp"
+#include "Domain/Model/Element.hpp"
+
+#include "domain/model/daruma_helper.hpp"
+
+#include <gtest/gtest.h>
+#include <filesystem>
+
+using namespace VGG;
+using namespace VGG::entry;
+
+class DocSnapshotTestSuite : public ::testing::Test
+{
+protected:
+  std::filesystem::path m_dir;
+
+  void SetUp() override
+  {
+    m_dir = std::filesystem::temp_directory_path() / "vgg_doc_snapshot_test";
+    std::filesystem::remove_all(m_dir);
+  }
+
+  void TearDown() override
+  {
+    std::filesystem::remove_all(m_dir);
+  }
+};
+
+TEST_F(DocSnapshotTestSuite, KeyDependsOnBothInputs)
+{
+  const nlohmann::json design = { { "a", 1 } };
+  const nlohmann::json layout = { { "b", 2 } };
+
+  EXPECT_EQ(DocSnapshot::key(design, layout), DocSnapshot::key(design, layout));
+  EXPECT_EQ(DocSnapshot::key(design, layout).size(), 32u);
+  EXPECT_NE(DocSnapshot::key(design, layout), DocSnapshot::key(layout, design));
+  EXPECT_NE(DocSnapshot::key(design, layout), DocSnapshot::key(design, nlohmann::json()));
+}
+
+TEST_F(DocSnapshotTestSuite, SaveAndLoad)
+{
+  // Given
+  const auto design = Helper::load_json("testDataDir/symbol/symbol_instance/design.json");
+
+  Layout::ExpandSymbol expand{ design };
+  expand();
+  const auto doc = expand.layout()->designDocTree();
+  const auto key = DocSnapshot::key(design, nlohmann::json());
+
+  // When
+  DocSnapshot::save(m_dir, key, *doc);
+  const auto loaded = DocSnapshot::load(m_dir, key);
+
+  // Then
+  ASSERT_TRUE(loaded);
+  EXPECT_EQ(nlohmann::json(loaded->treeModel()), nlohmann::json(doc->treeModel()));
+  EXPECT_EQ(DocSnapshot::load(m_dir, DocSnapshot::key(nlohmann::json(), design)), nullptr);
+}
@@ -0,0 +1,122 @@
+#include "Layer/VSkFontMgr.hpp"
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+class FontIndexTestSuite : public ::testing::Test
+{
+protected:
+  fs::path m_dir;
+  fs::path m_fontDir;
+  fs::path m_indexFile;
+
+  void SetUp() override
+  {
+    m_dir = fs::temp_directory_path() / "vgg_font_index_test";
+    fs::remove_all(m_dir);
+    m_fontDir = m_dir / "fonts";
+    m_indexFile = m_dir / "index.json";
+    fs::create_directories(m_fontDir / "nested");
+  }
+
+  void TearDown() override
+  {
+    fs::remove_all(m_dir);
+  }
+
+  // The files are not valid fonts, so they are indexed without faces
+  static void writeFile(const fs::path& path, const std::string& content)
+  {
+    std::ofstream ofs(path, std::ios::binary);
+    ofs << content;
+  }
+
+  void loadFonts()
+  {
+    VGGFontDirectory(std::vector<fs::path>{ m_fontDir }, m_indexFile);
+  }
+
+  FontIndex loadIndex()
+  {
+    FontIndex index;
+    EXPECT_TRUE(index.load(m_indexFile));
+    return index;
+  }
+};
+
+TEST_F(FontIndexTestSuite, RoundTrip)
+{
+  FontIndex index;
+  index.files["/fonts/a.ttc"] = { 42, 1024, { { 0, "Family A", 400, 5, 0, false } } };
+  index.files["/fonts/b.ttf"] = { 43,
+                                  2048,
+                                  { { 0, "Family B", 700, 5, 1, true },
+                                    { 1, "Family B Mono", 400, 3, 2, true } } };
+  index.files["/fonts/c.otf"] = { 44, 16, {} };
+  index.save(m_indexFile);
+
+  EXPECT_EQ(loadIndex(), index);
+}
+
+TEST_F(FontIndexTestSuite, RejectInvalidFile)
+{
+  writeFile(m_indexFile, "{ \"version\": 1, \"files\": [ { \"path\": 1 } ] }");
+
+  FontIndex index;
+  EXPECT_FALSE(index.load(m_indexFile));
+  EXPECT_TRUE(index.files.empty());
+}
+
+TEST_F(FontIndexTestSuite, RebuildWhenDirectoryChanged)
+{
+  const auto first = (m_fontDir / "first.ttf").string();
+  const auto nested = (m_fontDir / "nested" / "second.otf").string();
+  writeFile(first, "first");
+  writeFile(m_fontDir / "readme.txt", "not a font");
+
+  loadFonts();
+  {
+    const auto index = loadIndex();
+    ASSERT_EQ(index.files.size(), 1u);
+    EXPECT_EQ(index.files.at(first).size, 5u);
+  }
+
+  writeFile(first, "first changed");
+  writeFile(nested, "second");
+  loadFonts();
+  {
+    const auto index = loadIndex();
+    ASSERT_EQ(index.files.size(), 2u);
+    EXPECT_EQ(index.files.at(first).size, 13u);
+    EXPECT_EQ(index.files.at(nested).size, 6u);
+  }
+
+  fs::remove(first);
+  loadFonts();
+  {
+    const auto index = loadIndex();
+    ASSERT_EQ(index.files.size(), 1u);
+    EXPECT_TRUE(index.files.count(nested));
+  }
+}
+
+TEST_F(FontIndexTestSuite, UnchangedFilesAreNotScanned)
+{
+  const auto font = (m_fontDir / "font.ttf").string();
+  writeFile(font, "font");
+  loadFonts();
+
+  // The cached faces of an unchanged file are used as they are, the file is not a font actually
+  auto index = loadIndex();
+  index.files.at(font).faces.push_back({ 0, "Cached Family", 400, 5, 0, false });
+  index.save(m_indexFile);
+
+  auto mgr = VGGFontDirectory(std::vector<fs::path>{ m_fontDir }, m_indexFile);
+  auto set = mgr->matchFamily("Cached Family");
+  ASSERT_TRUE(set);
+  EXPECT_EQ(set->count(), 1);
+  EXPECT_EQ(loadIndex(), index);
+}
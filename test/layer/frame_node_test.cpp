@@ -0,0 +1,44 @@
+#include "Layer/Core/FrameNode.hpp"
+#include "Layer/Core/SceneNode.hpp"
+#include "Layer/Core/TransformNode.hpp"
+#include "Layer/Renderer.hpp"
+
+#include <core/SkPictureRecorder.h>
+#include <gtest/gtest.h>
+
+using namespace VGG::layer;
+
+TEST(FrameNodeTest, HiddenFramesAreNotBuiltByRendering)
+{
+  int  buildCount = 0;
+  auto builder = [&buildCount]() -> PaintNodePtr
+  {
+    buildCount++;
+    return nullptr;
+  };
+
+  std::vector<FramePtr> frames;
+  for (int i = 0; i < 3; i++)
+  {
+    frames.push_back(
+      FrameNode::Make(Matrix::Make(), builder, "frame" + std::to_string(i), i, false));
+  }
+  auto scene = SceneNode::Make(frames);
+  scene->revalidate();
+
+  SkPictureRecorder recorder;
+  auto              canvas = recorder.beginRecording(SkRect::MakeWH(100, 100));
+  Renderer          r = Renderer().createNew(canvas);
+  scene->render(&r);
+  for (const auto& frame : frames)
+  {
+    frame->render(&r);
+  }
+  recorder.finishRecordingAsPicture();
+
+  EXPECT_EQ(buildCount, 0);
+  for (const auto& frame : frames)
+  {
+    EXPECT_FALSE(frame->isBuilt());
+  }
+}
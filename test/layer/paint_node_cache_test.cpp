@@ -0,0 +1,74 @@
+#include "Layer/Core/Attrs.hpp"
+#include "Layer/Core/PaintNode.hpp"
+#include "Layer/Renderer.hpp"
+
+#include <core/SkBitmap.h>
+#include <core/SkCanvas.h>
+#include <core/SkSurface.h>
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+using namespace VGG::layer;
+
+namespace
+{
+constexpr int VIEW_SIZE = 160;
+
+PaintNodePtr makeShadowedFrame()
+{
+  auto frame = makePaintNodePtr(nullptr, 1, "frame", FRAME, "frame", RT_DEFAULT);
+  frame->setFrameBounds(Bounds{ 0, 0, 100, 100 });
+
+  Fill fill;
+  fill.type = Color{ 1.f, 0.f, 0.f, 1.f };
+  DropShadow shadow;
+  shadow.isEnabled = true;
+  shadow.color = Color{ 0.f, 0.f, 1.f, 1.f };
+  shadow.offsetX = 30;
+  shadow.offsetY = 30;
+  shadow.blur = 4;
+
+  Style style;
+  style.fills.push_back(fill);
+  style.dropShadow.push_back(shadow);
+  frame->setStyle(style);
+  return frame;
+}
+
+// Draws the frame into a view which only shows the part of the shadow out of the frame bounds
+SkBitmap draw(PaintNode* frame)
+{
+  auto surface = SkSurfaces::Raster(SkImageInfo::MakeN32Premul(VIEW_SIZE, VIEW_SIZE));
+  auto canvas = surface->getCanvas();
+  canvas->clear(SK_ColorTRANSPARENT);
+  canvas->translate(-105, -105);
+  Renderer r = Renderer().createNew(canvas);
+  frame->render(&r);
+
+  SkBitmap bitmap;
+  bitmap.allocPixels(surface->imageInfo());
+  surface->readPixels(bitmap, 0, 0);
+  return bitmap;
+}
+
+bool samePixels(const SkBitmap& a, const SkBitmap& b)
+{
+  return a.computeByteSize() == b.computeByteSize() &&
+         std::memcmp(a.getPixels(), b.getPixels(), a.computeByteSize()) == 0;
+}
+} // namespace
+
+TEST(PaintNodeCacheTest, CachedPictureKeepsTheShadow)
+{
+  auto frame = makeShadowedFrame();
+  frame->revalidate();
+  const auto direct = draw(frame.get());
+  ASSERT_NE(SkColorGetA(direct.getColor(5, 5)), 0u); // the shadow is out of the frame bounds
+
+  frame->setCacheBoundary(true);
+  const auto recorded = draw(frame.get()); // records the picture
+  const auto replayed = draw(frame.get()); // draws the retained picture
+  EXPECT_TRUE(samePixels(direct, recorded));
+  EXPECT_TRUE(samePixels(direct, replayed));
+}
@@ -0,0 +1,129 @@
+#include "Layer/LRUCache.hpp"
+#include "Layer/RasterCacheBudget.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace VGG::layer;
+
+namespace
+{
+class FakeClient : public RasterCacheBudget::Client
+{
+public:
+  LRUCache<int, int> cache{ 1024 };
+
+  FakeClient()
+  {
+    RasterCacheBudget::instance().add(this);
+  }
+
+  ~FakeClient() override
+  {
+    RasterCacheBudget::instance().remove(this);
+  }
+
+  size_t cachedBytes() const override
+  {
+    return cache.totalCost();
+  }
+
+  size_t evictBytes(size_t bytes) override
+  {
+    return cache.evict(bytes);
+  }
+};
+
+// Each entry holds its value in bytes, half of which is spare
+class SpareClient : public FakeClient
+{
+public:
+  size_t releaseSpareBytes(size_t bytes) override
+  {
+    return cache.shrink(
+      bytes,
+      [](int& value)
+      {
+        const auto released = value / 2;
+        value -= released;
+        return (size_t)released;
+      });
+  }
+};
+} // namespace
+
+TEST(LRUCacheTest, CostAccounting)
+{
+  LRUCache<int, int> cache(8);
+  cache.insert(1, 1, 100);
+  cache.insert(2, 2, 200);
+  cache.insertOrUpdate(3, 3, 300);
+  EXPECT_EQ(cache.totalCost(), 600u);
+
+  cache.insertOrUpdate(1, 10, 50);
+  EXPECT_EQ(cache.totalCost(), 550u);
+  EXPECT_EQ(cache.count(), 3);
+
+  // 1 is the most recently used, 2 is the least
+  EXPECT_EQ(cache.evict(1), 200u);
+  EXPECT_EQ(cache.find(2), nullptr);
+  EXPECT_NE(cache.find(1), nullptr);
+  EXPECT_EQ(cache.totalCost(), 350u);
+
+  cache.remove(3);
+  EXPECT_EQ(cache.totalCost(), 50u);
+  cache.purge();
+  EXPECT_EQ(cache.totalCost(), 0u);
+}
+
+TEST(RasterCacheBudgetTest, EnforceAndPurge)
+{
+  auto&      budget = RasterCacheBudget::instance();
+  const auto oldBudget = budget.budget();
+  budget.setBudget(1000);
+
+  FakeClient a;
+  FakeClient b;
+  for (int i = 0; i < 6; i++)
+  {
+    a.cache.insert(i, i, 100);
+  }
+  for (int i = 0; i < 3; i++)
+  {
+    b.cache.insert(i, i, 100);
+  }
+  EXPECT_EQ(budget.usedBytes(), 900u);
+  budget.enforce();
+  EXPECT_EQ(budget.usedBytes(), 900u);
+
+  a.cache.insert(6, 6, 300);
+  const auto evictionCount = budget.stats().evictionCount;
+  budget.enforce();
+  EXPECT_LE(budget.usedBytes(), 1000u);
+  EXPECT_GT(budget.stats().evictionCount, evictionCount);
+  EXPECT_EQ(b.cache.totalCost(), 300u); // the largest client is evicted first
+
+  purgeRasterCache(0);
+  EXPECT_EQ(budget.usedBytes(), 0u);
+  budget.setBudget(oldBudget);
+}
+
+TEST(RasterCacheBudgetTest, ReleaseSpareBytesBeforeEvicting)
+{
+  auto&      budget = RasterCacheBudget::instance();
+  const auto oldBudget = budget.budget();
+  budget.setBudget(1000);
+
+  SpareClient client;
+  for (int i = 0; i < 6; i++)
+  {
+    client.cache.insert(i, 200, 200);
+  }
+  const auto evictionCount = budget.stats().evictionCount;
+  budget.enforce();
+  EXPECT_LE(budget.usedBytes(), 1000u);
+  EXPECT_EQ(client.cache.count(), 6); // no tile is evicted
+  EXPECT_EQ(budget.stats().evictionCount, evictionCount);
+  EXPECT_EQ(*client.cache.find(5), 200); // the most recently used one keeps its spare
+
+  budget.setBudget(oldBudget);
+}
@@ -0,0 +1,240 @@
+#include "Layer/SimpleRasterExecutor.hpp"
+#include "Layer/ThreadPoolRasterExecutor.hpp"
+#include "Layer/RasterTask.hpp"
+
+#include <core/SkPictureRecorder.h>
+#include <core/SkPixmap.h>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <set>
+#include <thread>
+
+using namespace VGG::layer;
+
+namespace
+{
+class CountTask : public RasterManager::RasterTask
+{
+public:
+  CountTask(RasterManager::Key key, std::atomic_int& count)
+    : RasterManager::RasterTask(key)
+    , m_count(count)
+  {
+  }
+
+  RasterManager::RasterResult execute(GrRecordingContext* context) override
+  {
+    EXPECT_EQ(context, nullptr);
+    if (isCancelled())
+    {
+      return {};
+    }
+    m_count++;
+    return RasterManager::RasterResult(nullptr, makeTileSurface(context, 16, 16), index());
+  }
+
+private:
+  std::atomic_int& m_count;
+};
+
+class GatedTask : public RasterManager::RasterTask
+{
+public:
+  GatedTask(RasterManager::Key key, std::shared_future<void> gate)
+    : RasterManager::RasterTask(key)
+    , m_gate(std::move(gate))
+  {
+  }
+
+  RasterManager::RasterResult execute(GrRecordingContext* context) override
+  {
+    m_gate.wait();
+    return RasterManager::RasterResult(nullptr, makeTileSurface(context, 16, 16), index());
+  }
+
+private:
+  std::shared_future<void> m_gate;
+};
+
+sk_sp<SkPicture> makeFilledPicture(SkColor color)
+{
+  SkPictureRecorder recorder;
+  auto              canvas = recorder.beginRecording(SkRect::MakeWH(16, 16));
+  canvas->drawColor(color);
+  return recorder.finishRecordingAsPicture();
+}
+
+SkColor colorAt(const sk_sp<SkImage>& image, int x, int y)
+{
+  SkPixmap pixmap;
+  EXPECT_TRUE(image->peekPixels(&pixmap));
+  return pixmap.getColor(x, y);
+}
+} // namespace
+
+TEST(ThreadPoolRasterExecutorTest, ExecuteTasks)
+{
+  std::atomic_int          count{ 0 };
+  ThreadPoolRasterExecutor executor(4);
+  EXPECT_EQ(executor.threadCount(), 4);
+  EXPECT_EQ(executor.context(), nullptr);
+
+  std::vector<RasterManager::RasterResult::Future> futures;
+  for (RasterManager::Key i = 0; i < 64; ++i)
+  {
+    futures.push_back(executor.addRasterTask(std::make_unique<CountTask>(i, count)));
+  }
+
+  std::set<RasterManager::Key> keys;
+  for (auto& f : futures)
+  {
+    auto res = f.get();
+    EXPECT_TRUE(res.surf);
+    keys.insert(res.index());
+  }
+  EXPECT_EQ(count.load(), 64);
+  EXPECT_EQ(keys.size(), 64u);
+}
+
+TEST(ThreadPoolRasterExecutorTest, DrainOnDestruction)
+{
+  std::atomic_int count{ 0 };
+  {
+    ThreadPoolRasterExecutor executor(2);
+    for (int i = 0; i < 16; ++i)
+    {
+      executor.add([&count]() { count++; });
+    }
+  }
+  EXPECT_EQ(count.load(), 16);
+}
+
+TEST(ThreadPoolRasterExecutorTest, NotifyRasterized)
+{
+  std::atomic_int count{ 0 };
+  std::atomic_int rasterized{ 0 };
+  {
+    ThreadPoolRasterExecutor executor(2, nullptr, [&rasterized]() { rasterized++; });
+    for (RasterManager::Key i = 0; i < 16; ++i)
+    {
+      executor.addRasterTask(std::make_unique<CountTask>(i, count));
+    }
+    executor.add([&count]() { count++; }); // not a raster task
+  }
+  EXPECT_EQ(count.load(), 17);
+  EXPECT_EQ(rasterized.load(), 16);
+}
+
+TEST(RasterManagerTest, BatchQueryWithoutBlocking)
+{
+  ThreadPoolRasterExecutor executor(2);
+  RasterManager            manager(&executor);
+
+  std::promise<void> gate;
+  auto               opened = gate.get_future().share();
+  for (RasterManager::Key k = 0; k < 4; k++)
+  {
+    manager.appendRasterTask(std::make_unique<GatedTask>(k, opened));
+  }
+
+  std::vector<RasterManager::RasterResult> ready;
+  std::vector<RasterManager::Key>          pending;
+  std::vector<RasterManager::Key>          missing;
+  manager.query({ 0, 1, 2, 3, 4 }, &ready, &pending, &missing);
+  EXPECT_TRUE(ready.empty());
+  EXPECT_EQ(pending.size(), 4u);
+  EXPECT_EQ(missing, std::vector<RasterManager::Key>{ 4 });
+  EXPECT_FALSE(manager.find(0));
+
+  gate.set_value();
+  EXPECT_TRUE(manager.query(0)); // waits only for the queried tile
+  for (RasterManager::Key k = 1; k < 4; k++)
+  {
+    EXPECT_TRUE(manager.query(k));
+  }
+
+  ready.clear();
+  pending.clear();
+  missing.clear();
+  manager.poll();
+  manager.query({ 0, 1, 2, 3 }, &ready, &pending, &missing);
+  EXPECT_EQ(ready.size(), 4u);
+  EXPECT_TRUE(pending.empty());
+  EXPECT_TRUE(missing.empty());
+  EXPECT_GT(manager.cachedBytes(), 0u);
+}
+
+TEST(RasterManagerTest, CancelTasksOnUpdate)
+{
+  std::atomic_int          count{ 0 };
+  ThreadPoolRasterExecutor executor(1);
+  RasterManager            manager(&executor);
+
+  // the worker is blocked so the tasks below are still queued on update
+  std::promise<void> gate;
+  manager.appendRasterTask(std::make_unique<GatedTask>(0, gate.get_future().share()));
+  manager.appendRasterTask(std::make_unique<CountTask>(1, count));
+  manager.prefetchRasterTask(std::make_unique<CountTask>(2, count));
+
+  std::vector<std::unique_ptr<RasterManager::RasterTask>> tasks;
+  tasks.push_back(std::make_unique<CountTask>(3, count));
+  manager.update(std::move(tasks));
+  EXPECT_FALSE(manager.hasTile(1));
+  EXPECT_FALSE(manager.hasTile(2));
+
+  gate.set_value();
+  EXPECT_TRUE(manager.query(3));
+  EXPECT_EQ(count.load(), 1); // the tasks queued before are skipped
+  EXPECT_FALSE(manager.find(1));
+}
+
+TEST(RasterManagerTest, ExecuteDeferredTaskOnBatchQuery)
+{
+  std::atomic_int      count{ 0 };
+  SimpleRasterExecutor executor(nullptr);
+  RasterManager        manager(&executor);
+  EXPECT_FALSE(executor.isConcurrent());
+
+  manager.prefetchRasterTask(std::make_unique<CountTask>(0, count));
+  EXPECT_TRUE(manager.hasTile(0));
+  EXPECT_EQ(count.load(), 0); // deferred
+
+  std::vector<RasterManager::RasterResult> ready;
+  std::vector<RasterManager::Key>          pending;
+  manager.query({ 0 }, &ready, &pending, nullptr);
+  EXPECT_EQ(count.load(), 1);
+  EXPECT_EQ(ready.size(), 1u);
+  EXPECT_TRUE(pending.empty());
+}
+
+TEST(RasterTaskTest, DrawDamageOnSpareSurface)
+{
+  using Where = TileTask::Where;
+  const auto whole = std::vector{ Where{ .dst = { 0, 0 }, .src = Bounds(0, 0, 16, 16) } };
+  const auto damage = std::vector{ Where{ .dst = { 0, 0 }, .src = Bounds(0, 0, 8, 8) } };
+  const auto red = makeFilledPicture(SK_ColorRED);
+  const auto blue = makeFilledPicture(SK_ColorBLUE);
+
+  TileTask first(nullptr, 0, 16, 16, SK_ColorTRANSPARENT, whole, glm::mat3(1), red);
+  auto     r1 = first.execute(nullptr);
+  ASSERT_TRUE(r1.image);
+  EXPECT_FALSE(r1.spare);
+  const auto front = r1.surf;
+
+  TileTask second(nullptr, 0, 16, 16, SK_ColorTRANSPARENT, damage, glm::mat3(1), blue, r1);
+  auto     r2 = second.execute(nullptr);
+  EXPECT_NE(r2.surf.get(), front.get());
+  EXPECT_EQ(r2.spare.get(), front.get());
+  EXPECT_EQ(colorAt(r2.image, 4, 4), SK_ColorBLUE);
+  EXPECT_EQ(colorAt(r2.image, 12, 12), SK_ColorRED); // kept outside of the damage
+  EXPECT_EQ(colorAt(r1.image, 4, 4), SK_ColorRED);   // the previous image is not changed
+  EXPECT_EQ(r2.bytes(), 2 * r1.bytes());
+
+  // the surfaces are swapped on each damage update
+  const auto back = r2.surf;
+  TileTask   third(nullptr, 0, 16, 16, SK_ColorTRANSPARENT, damage, glm::mat3(1), red, r2);
+  auto       r3 = third.execute(nullptr);
+  EXPECT_EQ(r3.surf.get(), front.get());
+  EXPECT_EQ(r3.spare.get(), back.get());
+  EXPECT_EQ(colorAt(r3.image, 4, 4), SK_ColorRED);
+}
@@ -13,10 +13,24 @@ using namespace nlohmann;
 
 #define JSON_SCHEMA_FILE_NAME design_doc_schema_file
 
+// Counts the copies of the whole document
+class CountingJsonDocument : public RawJsonDocument
+{
+public:
+  mutable int copy_count{ 0 };
+
+  json content() const override
+  {
+    ++copy_count;
+    return RawJsonDocument::content();
+  }
+};
+
 class SchemaValidJsonDocumentTestSuite : public ::testing::Test
 {
 protected:
   std::shared_ptr<SchemaValidJsonDocument> sut;
+  std::shared_ptr<CountingJsonDocument>    raw_json_doc;
 
   void SetUp() override
   {
@@ -30,7 +44,7 @@ protected:
     auto schema_validator = std::make_shared<JsonSchemaValidator>();
     schema_validator->setRootSchema(schema);
 
-    auto raw_json_doc = std::make_shared<RawJsonDocument>();
+    raw_json_doc = std::make_shared<CountingJsonDocument>();
     raw_json_doc->setContent(document);
 
     sut.reset(new SchemaValidJsonDocument(raw_json_doc, schema_validator));
@@ -111,3 +125,24 @@ TEST_F(SchemaValidJsonDocumentTestSuite, Delete_ChangeColorToInvalidValue)
 
   GTEST_FAIL();
 }
+
+TEST_F(SchemaValidJsonDocumentTestSuite, Replace_ValidValueWithoutCopyingDocument)
+{
+  const auto path = "/symbolMaster/0/backgroundColor/alpha"_json_pointer;
+  const auto value = 0.5;
+  sut->replaceAt(path, value);
+
+  EXPECT_EQ(raw_json_doc->contentView()[path], value);
+  EXPECT_EQ(raw_json_doc->copy_count, 0);
+}
+
+TEST_F(SchemaValidJsonDocumentTestSuite, Replace_InvalidValueIsRejected)
+{
+  const auto path = "/symbolMaster/0/backgroundColor/alpha"_json_pointer;
+  const auto old_value = raw_json_doc->contentView()[path];
+
+  EXPECT_THROW(sut->replaceAt(path, 2), std::logic_error); // alpha is in [0, 1]
+
+  EXPECT_EQ(raw_json_doc->contentView()[path], old_value);
+  EXPECT_EQ(raw_json_doc->copy_count, 0);
+}
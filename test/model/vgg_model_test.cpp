@@ -170,3 +170,31 @@ TEST_F(VggModelTestSuite, load_layout_doc)
   // Then
   EXPECT_TRUE(layoutDoc);
 }
+
+TEST_F(VggModelTestSuite, read_missing_resource)
+{
+  // Given
+  std::string filePath = "testDataDir/layout/0_space_between/";
+  auto        ret = m_sut->load(filePath);
+  EXPECT_EQ(ret, true);
+
+  // When
+  auto blob = m_sut->readResource("resources/not_exist.png");
+
+  // Then
+  EXPECT_FALSE(blob);
+}
+
+TEST_F(VggModelTestSuite, load_mapped_dir)
+{
+  // Given
+  std::string filePath = "testDataDir/layout/0_space_between/";
+
+  // When
+  auto ret = m_sut->load(filePath, true);
+
+  // Then
+  EXPECT_EQ(ret, true);
+  EXPECT_TRUE(m_sut->designDoc());
+  EXPECT_TRUE(m_sut->layoutDoc());
+}
@@ -1,13 +1,16 @@
 #include "Adapter/NativeExec.hpp"
 
 #include "Adapter/Environment.hpp"
+#include "Application/VggEnv.hpp"
 #include "Utility/Log.hpp"
 
 #include "test_config.hpp"
 
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <memory>
+#include <thread>
 
 using namespace VGG;
 
@@ -244,6 +247,40 @@ TEST_F(VggNativeExecTestSuite, Internal_evalModule_2)
   EXPECT_EQ(result, true);
 }
 
+TEST_F(VggNativeExecTestSuite, Dispatch_event)
+{
+  // Given
+  auto env = std::make_shared<VggEnv>();
+
+  // When
+  auto result = sut_ptr->dispatchEvent(R"({"type":"click"})", env);
+
+  // Then
+  EXPECT_EQ(result, true);
+}
+
+TEST_F(VggNativeExecTestSuite, Task_queue_stats)
+{
+  // Given
+  const auto before = sut_ptr->taskQueueStats().taskCount;
+
+  // When
+  for (int i = 0; i < 3; ++i)
+  {
+    EXPECT_EQ(sut_ptr->evalScript("1"), true);
+  }
+  for (int i = 0; i < 100 && sut_ptr->taskQueueStats().taskCount < before + 3; ++i)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  // Then
+  const auto stats = sut_ptr->taskQueueStats();
+  EXPECT_GE(stats.taskCount, before + 3);
+  EXPECT_GE(stats.maxDepth, 1u);
+  EXPECT_GE(stats.batchCount, 1u);
+}
+
 TEST_F(VggNativeExecTestSuite, Eval_module_smoke)
 {
   auto code = "console.log('Hello everyone!');";
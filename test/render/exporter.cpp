@@ -103,6 +103,13 @@ int main(int argc, char** argv)
     .help("image quality [0(low),100(high)]")
     .scan<'i', int>()
     .default_value(80);
+  program.add_argument("-b", "--backend")
+    .help("render backend: vulkan, raster")
+    .default_value(std::string("vulkan"));
+  program.add_argument("-j", "--jobs")
+    .help("rasterize and encode frames on n cpu threads, 0 for the gpu serial export")
+    .scan<'i', int>()
+    .default_value(0);
   program.add_argument("-o", "--output").help("output directory");
   program.add_argument("-f", "--file-format").help("imageformat: png, jpg, webp, svg, pdf");
   program.add_argument("-t").help("postfix for output filename");
@@ -111,6 +118,8 @@ int main(int argc, char** argv)
     .help("disable replace for symbol instance")
     .implicit_value(true);
 
+  program.add_argument("--snapshot-dir").help("cache the expanded documents in the dir");
+
   program.add_argument("--repl").help("run as REPL mode").implicit_value(true);
 
   try
@@ -195,6 +204,7 @@ int main(int argc, char** argv)
   }
   int s = program.get<int>("-q");
   opts.imageQuality = s;
+  opts.threadCount = program.get<int>("-j");
 
   if (auto cfg = program.present("-c"))
   {
@@ -208,8 +218,13 @@ int main(int argc, char** argv)
   if (auto cfg = program.present<bool>("--disable-layout"))
     exportOpt.enableLayout = false;
 
+  if (auto dir = program.present("--snapshot-dir"))
+    exportOpt.snapshotDir = *dir;
+
+  const auto backend = program.get<std::string>("-b") == "raster" ? exporter::EBackend::RASTER
+                                                                   : exporter::EBackend::VULKAN;
   exporter::ExporterInfo info;
-  exporter::Exporter     exporter;
+  exporter::Exporter     exporter(backend);
   exporter.info(&info);
   INFO("%s", info.graphicsInfo.c_str());
   auto loadfile = program.get<std::string>(POS_ARG_INPUT_FILE);
@@ -0,0 +1,153 @@
+#include "Layer/Core/DefaultResourceProvider.hpp"
+#include "Layer/Core/ResourceManager.hpp"
+#include "Layer/GlobalSettings.hpp"
+
+#include "VGG/Exporter/ImageExporter.hpp"
+#include "VGG/Exporter/Type.hpp"
+
+#include <argparse/argparse.hpp>
+#include <nlohmann/json.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Exports every design.json found under the given directory with the vulkan and the raster
+// backends, and prints the time cost of both paths.
+using namespace VGG;
+namespace fs = std::filesystem;
+
+struct BenchResult
+{
+  int                                frames{ 0 };
+  double                             total{ 0 }; // wall time in seconds
+  exporter::IteratorResult::TimeCost cost;
+};
+
+static nlohmann::json readJson(const fs::path& path)
+{
+  std::ifstream  ifs(path);
+  nlohmann::json json;
+  if (ifs.is_open())
+  {
+    try
+    {
+      ifs >> json;
+    }
+    catch (const std::exception& e)
+    {
+      std::cout << "failed to parse " << path << ": " << e.what() << std::endl;
+    }
+  }
+  return json;
+}
+
+static BenchResult bench(
+  exporter::Exporter&          exporter,
+  const nlohmann::json&        design,
+  const nlohmann::json&        layout,
+  const exporter::ImageOption& opts,
+  int                          repeat)
+{
+  BenchResult res;
+  const auto  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < repeat; ++i)
+  {
+    exporter::BuilderResult buildResult;
+    auto iter = exporter.render(design, layout, opts, exporter::ExportOption{}, buildResult);
+    while (auto r = iter.next())
+    {
+      ++res.frames;
+      if (r.timeCost)
+      {
+        res.cost += *r.timeCost;
+      }
+    }
+  }
+  res.total = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  return res;
+}
+
+int main(int argc, char** argv)
+{
+  layer::setupEnv();
+  argparse::ArgumentParser program("exporter_bench", "0.1");
+  program.add_argument("dir")
+    .help("directory searched for design.json")
+    .default_value(std::string("testDataDir"));
+  program.add_argument("-r", "--repeat").help("repeat times").scan<'i', int>().default_value(3);
+  program.add_argument("-q", "--quality")
+    .help("image quality [0(low),100(high)]")
+    .scan<'i', int>()
+    .default_value(80);
+  program.add_argument("--raster-only").help("skip the vulkan backend").implicit_value(true);
+  try
+  {
+    program.parse_args(argc, argv);
+  }
+  catch (const std::runtime_error& err)
+  {
+    std::cout << err.what() << std::endl;
+    std::cout << program;
+    return 1;
+  }
+
+  const auto root = fs::path(program.get<std::string>("dir"));
+  const auto repeat = program.get<int>("-r");
+  const bool rasterOnly = program.is_used("--raster-only");
+
+  exporter::ImageOption opts;
+  opts.type = exporter::PNG;
+  opts.imageQuality = program.get<int>("-q");
+
+  std::vector<std::pair<const char*, exporter::EBackend>> backends{
+    { "raster", exporter::EBackend::RASTER }
+  };
+  if (!rasterOnly)
+  {
+    backends.emplace_back("vulkan", exporter::EBackend::VULKAN);
+  }
+
+  std::printf(
+    "%-40s %-8s %8s %10s %10s %10s\n",
+    "file",
+    "backend",
+    "frames",
+    "render(s)",
+    "encode(s)",
+    "total(s)");
+  for (const auto& [name, backend] : backends)
+  {
+    exporter::Exporter exporter(backend);
+    for (const auto& entry : fs::recursive_directory_iterator(root))
+    {
+      if (!entry.is_regular_file() || entry.path().filename() != "design.json")
+        continue;
+      const auto dir = entry.path().parent_path();
+      auto       design = readJson(entry.path());
+      if (!design.is_object())
+        continue;
+      auto layout = fs::exists(dir / "layout.json") ? readJson(dir / "layout.json")
+                                                    : nlohmann::json{};
+      layer::setGlobalResourceProvider(std::make_unique<layer::FileResourceProvider>(dir));
+
+      const auto res = bench(exporter, design, layout, opts, repeat);
+      std::printf(
+        "%-40s %-8s %8d %10.3f %10.3f %10.3f\n",
+        fs::relative(dir, root).string().c_str(),
+        name,
+        res.frames,
+        res.cost.render,
+        res.cost.encode,
+        res.total);
+    }
+  }
+  return 0;
+}